@@ -24,6 +24,7 @@
  *
  */
 
+#include <atomic>
 #include <iostream>
 
 #include "Cats/Corecat/Util.hpp"
@@ -48,6 +49,12 @@ int main(int argc, char** argv) {
         for(auto&& x : RecursiveDirectory(argv[1]))
             std::cout << String8(x.getString()) << std::endl;
         
+        std::cout << std::endl;
+        
+        std::atomic<std::size_t> count{0};
+        DirectoryWalker().walk(argv[1], [&](const DirectoryWalker::Entry&) { ++count; return true; });
+        std::cout << count << std::endl;
+        
     } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
     
     return 0;
@@ -0,0 +1,99 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <iostream>
+
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Filesystem.hpp"
+#include "Cats/Netycat/IOExecutor.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+const char* getEventName(DirectoryWatcher::EventType type) {
+    
+    switch(type) {
+    case DirectoryWatcher::EventType::ADDED: return "ADDED";
+    case DirectoryWatcher::EventType::REMOVED: return "REMOVED";
+    case DirectoryWatcher::EventType::MODIFIED: return "MODIFIED";
+    case DirectoryWatcher::EventType::RENAMED: return "RENAMED";
+    case DirectoryWatcher::EventType::QUEUE_OVERFLOW: return "QUEUE_OVERFLOW";
+    default: return "UNKNOWN";
+    }
+    
+}
+
+void watch(DirectoryWatcher& watcher, bool& removed) {
+    
+    watcher.read([&](auto& e, auto events) {
+        
+        if(e) e.rethrow();
+        for(auto&& event : events) {
+            
+            std::cout << getEventName(event.type) << " " << String8(event.name.getString());
+            if(event.type == DirectoryWatcher::EventType::RENAMED) std::cout << " <- " << String8(event.oldName.getString());
+            std::cout << std::endl;
+            if(event.type == DirectoryWatcher::EventType::REMOVED) removed = true;
+            
+        }
+        if(!removed) watch(watcher, removed);
+        
+    });
+    
+}
+
+int main(int argc, char** argv) {
+    
+    try {
+        
+        if(argc < 2) throw InvalidArgumentException("Directory name needed");
+        
+        IOExecutor executor;
+        DirectoryWatcher watcher(executor, argv[1]);
+        FilePath path = FilePath(argv[1]) / FilePath("watch.txt");
+        FilePath newPath = FilePath(argv[1]) / FilePath("watch.bin");
+        bool removed = false;
+        watch(watcher, removed);
+        
+        executor.wait(0.1, [&] {
+            
+            {
+                File file(path, File::Mode::WRITE | File::Mode::CREATE_TRUNCATE);
+                file.write(reinterpret_cast<const Byte*>("Netycat"), 7, 0);
+            }
+            if(!::MoveFileW(path.getData(), newPath.getData())) throw IOException("::MoveFileW failed");
+            if(!::DeleteFileW(newPath.getData())) throw IOException("::DeleteFileW failed");
+            
+        });
+        executor.run();
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
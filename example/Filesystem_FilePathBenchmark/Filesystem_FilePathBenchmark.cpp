@@ -0,0 +1,108 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Filesystem.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t ROUND_COUNT = 20;
+
+
+template <typename F>
+void benchmark(const char* name, std::size_t count, F f) {
+    
+    volatile std::size_t sink = 0;
+    auto start = HighResolutionClock::now();
+    for(std::size_t i = 0; i < ROUND_COUNT; ++i) sink += f();
+    std::chrono::duration<double, std::nano> time = HighResolutionClock::now() - start;
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+        << time.count() / double(ROUND_COUNT * count) << " ns/path" << std::endl;
+    
+}
+
+int main(int argc, char** argv) {
+    
+    try {
+        
+        if(argc < 2) throw InvalidArgumentException("Directory name needed");
+        
+        FilePath root = FilePath(argv[1]).normalize();
+        std::vector<FilePath::StringType> strings;
+        std::vector<FilePath> paths, noisyPaths;
+        for(auto&& x : RecursiveDirectory(root)) {
+            
+            strings.push_back(x.getString());
+            paths.push_back(x);
+            noisyPaths.push_back(x / FilePath(".") / FilePath("noise") / FilePath(".."));
+            
+        }
+        if(paths.empty()) throw InvalidArgumentException("Directory is empty");
+        std::cout << paths.size() << " paths" << std::endl;
+        
+        benchmark("construct", paths.size(), [&] {
+            std::size_t n = 0;
+            for(auto&& x : strings) n += FilePath(x).getFilenameString().getLength();
+            return n;
+        });
+        benchmark("findLastSeparator", paths.size(), [&] {
+            std::size_t n = 0;
+            for(auto&& x : strings) n += Filesystem::Impl::findLastSeparator(x.getData(), x.getData() + x.getLength()) != nullptr;
+            return n;
+        });
+        benchmark("findLastSeparatorScalar", paths.size(), [&] {
+            std::size_t n = 0;
+            for(auto&& x : strings) n += Filesystem::Impl::findLastSeparatorScalar(x.getData(), x.getData() + x.getLength()) != nullptr;
+            return n;
+        });
+        benchmark("normalize", paths.size(), [&] {
+            std::size_t n = 0;
+            for(auto&& x : noisyPaths) n += x.normalize().getString().getLength();
+            return n;
+        });
+        benchmark("lexicallyRelative", paths.size(), [&] {
+            std::size_t n = 0;
+            for(auto&& x : paths) n += x.lexicallyRelative(root).getString().getLength();
+            return n;
+        });
+        
+        for(std::size_t i = 0; i < paths.size(); ++i)
+            if(noisyPaths[i].normalize() != (paths[i] / FilePath(".")).normalize()) throw IOException("Normalization mismatch");
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,113 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstring>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Filesystem.hpp"
+#include "Cats/Netycat/IOExecutor.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t PRODUCER_COUNT = 2;
+constexpr std::size_t FRAME_COUNT = 100000;
+
+
+void runProducer(MappedFile& mappedFile, std::uint32_t id) {
+    
+    try {
+        
+        MappedRingBuffer ring(mappedFile, "Example", MappedRingBuffer::Mode::MULTI_PRODUCER);
+        for(std::uint32_t i = 0; i < FRAME_COUNT; ++i) {
+            
+            std::uint32_t frame[2] = {id, i};
+            while(!ring.tryWrite(frame, sizeof(frame))) std::this_thread::yield();
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+void consume(IOExecutor& executor, MappedRingBuffer& ring, std::vector<std::uint32_t>& next, std::size_t& count) {
+    
+    ring.wait(executor, [&](auto& e) {
+        
+        if(e) e.rethrow();
+        std::size_t size;
+        while(auto data = ring.peek(size)) {
+            
+            std::uint32_t frame[2];
+            std::memcpy(frame, data, sizeof(frame));
+            if(frame[1] != next[frame[0]]++) throw IOException("Frame out of order");
+            ring.pop();
+            ++count;
+            
+        }
+        if(count < PRODUCER_COUNT * FRAME_COUNT) consume(executor, ring, next, count);
+        
+    });
+    
+}
+
+
+int main(int argc, char** argv) {
+    
+    try {
+        
+        if(argc < 2) throw InvalidArgumentException("File name needed");
+        
+        File file(argv[1], File::Mode::READ_WRITE | File::Mode::CREATE_TRUNCATE);
+        std::size_t size = std::size_t(MappedRingBuffer::getRequiredSize(1 << 16));
+        file.setSize(size);
+        MappedFile mappedFile(file, 0, size, MappedFile::Mode::READ_WRITE);
+        
+        IOExecutor executor;
+        MappedRingBuffer ring(mappedFile, "Example", MappedRingBuffer::Mode::MULTI_PRODUCER);
+        std::vector<std::uint32_t> next(PRODUCER_COUNT);
+        std::size_t count = 0;
+        consume(executor, ring, next, count);
+        
+        std::vector<std::thread> producers;
+        for(std::uint32_t i = 0; i < PRODUCER_COUNT; ++i)
+            producers.emplace_back(runProducer, std::ref(mappedFile), i);
+        executor.run();
+        for(auto&& x : producers) x.join();
+        
+        std::cout << "Consumed " << count << " frames" << std::endl;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
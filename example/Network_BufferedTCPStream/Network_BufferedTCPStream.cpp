@@ -0,0 +1,122 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t MESSAGE_COUNT = 100000;
+
+
+void runClient(std::uint16_t port) {
+    
+    try {
+        
+        TCPSocket socket;
+        socket.connect(IPv4Address::getLoopback(), port);
+        BufferedTCPStream stream(socket);
+        char buffer[256] = "Hello, Netycat!\n";
+        for(std::size_t i = 0; i < MESSAGE_COUNT; ++i) {
+            
+            std::uint8_t size = std::uint8_t(16 + i % 64);
+            stream.write(&size, 1);
+            stream.write(buffer, size);
+            
+        }
+        stream.flush();
+        stream.readExactly(buffer, 1);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+template <typename F>
+void benchmark(const char* name, std::uint16_t port, F f) {
+    
+    TCPServer server;
+    TCPSocket socket;
+    server.listen(IPv4Address::getLoopback(), port);
+    std::thread thread(runClient, port);
+    server.accept(socket);
+    
+    auto start = HighResolutionClock::now();
+    f(socket);
+    std::chrono::duration<double, std::nano> time = HighResolutionClock::now() - start;
+    char ack = 0;
+    socket.writeAll(&ack, 1);
+    thread.join();
+    
+    std::cout << std::left << std::setw(20) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+        << time.count() / double(MESSAGE_COUNT) << " ns/message" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        benchmark("TCPSocket", 12345, [](TCPSocket& socket) {
+            
+            char buffer[256];
+            std::uint8_t size;
+            for(std::size_t i = 0; i < MESSAGE_COUNT; ++i) {
+                
+                socket.readAll(&size, 1);
+                socket.readAll(buffer, size);
+                
+            }
+            
+        });
+        benchmark("BufferedTCPStream", 12346, [](TCPSocket& socket) {
+            
+            BufferedTCPStream stream(socket);
+            char buffer[256];
+            std::uint8_t size;
+            for(std::size_t i = 0; i < MESSAGE_COUNT; ++i) {
+                
+                stream.readExactly(&size, 1);
+                stream.readExactly(buffer, size);
+                
+            }
+            if(stream.getReadSize()) throw IOException("Unexpected data");
+            
+        });
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
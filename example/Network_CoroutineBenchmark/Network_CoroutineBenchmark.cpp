@@ -0,0 +1,264 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+
+#include "Cats/Corecat/Concurrent.hpp"
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t ROUND_COUNT = 100000;
+constexpr std::size_t WAIT_COUNT = 1000000;
+constexpr std::size_t MESSAGE_SIZE = 64;
+
+
+struct Task {
+    
+    struct promise_type {
+        
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+        
+    };
+    
+};
+
+void print(const char* name, double time, std::size_t count, const char* unit) {
+    
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed << std::setprecision(3)
+        << time / double(count) << " us/" << unit << std::endl;
+    
+}
+
+
+class PromiseServer : public Coroutine<PromiseServer> {
+    
+private:
+    
+    IOExecutor& executor;
+    std::uint16_t port;
+    TCPServer server{executor};
+    TCPSocket socket{executor};
+    char buffer[MESSAGE_SIZE];
+    std::size_t i;
+    
+public:
+    
+    PromiseServer(IOExecutor& executor_, std::uint16_t port_) : executor(executor_), port(port_) {}
+    
+    void operator ()() {
+        
+        try {
+            
+            CORECAT_COROUTINE {
+                
+                server.setOption(TCPOption::noDelay(true));
+                server.listen(IPv4Address::getLoopback(), port);
+                CORECAT_AWAIT(server.acceptAsync(socket));
+                for(i = 0; i < ROUND_COUNT; ++i) {
+                    
+                    CORECAT_AWAIT(socket.readAllAsync(buffer, MESSAGE_SIZE));
+                    CORECAT_AWAIT(socket.writeAllAsync(buffer, MESSAGE_SIZE));
+                    
+                }
+                
+            }
+            
+        } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+        
+    }
+    
+};
+
+class PromiseClient : public Coroutine<PromiseClient> {
+    
+private:
+    
+    IOExecutor& executor;
+    std::uint16_t port;
+    TCPSocket socket{executor};
+    char buffer[MESSAGE_SIZE] = {};
+    std::size_t i;
+    HighResolutionClock::time_point start;
+    
+public:
+    
+    PromiseClient(IOExecutor& executor_, std::uint16_t port_) : executor(executor_), port(port_) {}
+    
+    void operator ()() {
+        
+        try {
+            
+            CORECAT_COROUTINE {
+                
+                CORECAT_AWAIT(socket.connectAsync(IPv4Address::getLoopback(), port));
+                socket.setOption(TCPOption::noDelay(true));
+                start = HighResolutionClock::now();
+                for(i = 0; i < ROUND_COUNT; ++i) {
+                    
+                    CORECAT_AWAIT(socket.writeAllAsync(buffer, MESSAGE_SIZE));
+                    CORECAT_AWAIT(socket.readAllAsync(buffer, MESSAGE_SIZE));
+                    
+                }
+                print("Promise ping-pong", std::chrono::duration<double, std::micro>(HighResolutionClock::now() - start).count(), ROUND_COUNT, "round trip");
+                
+            }
+            
+        } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+        
+    }
+    
+};
+
+class PromiseWaiter : public Coroutine<PromiseWaiter> {
+    
+private:
+    
+    IOExecutor& executor;
+    std::size_t i;
+    HighResolutionClock::time_point start;
+    
+public:
+    
+    PromiseWaiter(IOExecutor& executor_) : executor(executor_) {}
+    
+    void operator ()() {
+        
+        try {
+            
+            CORECAT_COROUTINE {
+                
+                start = HighResolutionClock::now();
+                for(i = 0; i < WAIT_COUNT; ++i) CORECAT_AWAIT(executor.waitAsync(0));
+                print("Promise wait", std::chrono::duration<double, std::micro>(HighResolutionClock::now() - start).count(), WAIT_COUNT, "wait");
+                
+            }
+            
+        } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+        
+    }
+    
+};
+
+
+Task runServer(TCPServer& server, TCPSocket& socket) {
+    
+    try {
+        
+        char buffer[MESSAGE_SIZE];
+        co_await server.acceptAwait(socket);
+        for(std::size_t i = 0; i < ROUND_COUNT; ++i) {
+            
+            co_await socket.readAllAwait(buffer, MESSAGE_SIZE);
+            co_await socket.writeAllAwait(buffer, MESSAGE_SIZE);
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+Task runClient(TCPSocket& socket, std::uint16_t port) {
+    
+    try {
+        
+        char buffer[MESSAGE_SIZE] = {};
+        co_await socket.connectAwait(IPv4Address::getLoopback(), port);
+        socket.setOption(TCPOption::noDelay(true));
+        auto start = HighResolutionClock::now();
+        for(std::size_t i = 0; i < ROUND_COUNT; ++i) {
+            
+            co_await socket.writeAllAwait(buffer, MESSAGE_SIZE);
+            co_await socket.readAllAwait(buffer, MESSAGE_SIZE);
+            
+        }
+        print("co_await ping-pong", std::chrono::duration<double, std::micro>(HighResolutionClock::now() - start).count(), ROUND_COUNT, "round trip");
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+Task runWaiter(IOExecutor& executor) {
+    
+    auto start = HighResolutionClock::now();
+    for(std::size_t i = 0; i < WAIT_COUNT; ++i) co_await executor.sleep(0);
+    print("co_await sleep", std::chrono::duration<double, std::micro>(HighResolutionClock::now() - start).count(), WAIT_COUNT, "wait");
+    
+}
+
+
+void benchmarkPromise(std::uint16_t port) {
+    
+    IOExecutor executor;
+    (*std::make_shared<PromiseServer>(executor, port))();
+    (*std::make_shared<PromiseClient>(executor, port))();
+    executor.run();
+    (*std::make_shared<PromiseWaiter>(executor))();
+    executor.run();
+    
+}
+
+void benchmarkAwait(std::uint16_t port) {
+    
+    IOExecutor executor;
+    TCPServer server(executor);
+    TCPSocket serverSocket(executor);
+    TCPSocket clientSocket(executor);
+    server.setOption(TCPOption::noDelay(true));
+    server.listen(IPv4Address::getLoopback(), port);
+    runServer(server, serverSocket);
+    runClient(clientSocket, port);
+    executor.run();
+    runWaiter(executor);
+    executor.run();
+    
+}
+
+int main() {
+    
+    try {
+        
+        benchmarkPromise(12345);
+        benchmarkAwait(12346);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,103 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t REQUEST_COUNT = 5000;
+constexpr std::size_t CONCURRENCY = 32;
+constexpr std::size_t CONNECTION_COUNT = 8;
+
+
+bool benchmark(const char* name, bool keepAlive, std::size_t pipelineDepth) {
+    
+    IOExecutor executor;
+    HTTPClient client(executor);
+    client.setMaxConnectionCount(CONNECTION_COUNT);
+    client.setPipelineDepth(pipelineDepth);
+    client.setIdleTimeout(1.0);
+    TCPEndpoint endpoint(IPv4Address::getLoopback(), 12345);
+    std::size_t issued = 0, completed = 0, failed = 0;
+    auto start = HighResolutionClock::now(), finish = start;
+    
+    std::function<void()> issue = [&]() {
+        
+        ++issued;
+        HTTPRequest request("GET", "/");
+        if(!keepAlive) request.setHeader("Connection", "close");
+        client.request(endpoint, std::move(request), [&](auto& e, auto& response) {
+            
+            if(e || response.getStatus() != 200) ++failed;
+            if(++completed == REQUEST_COUNT) { finish = HighResolutionClock::now(); client.close(); }
+            else if(issued < REQUEST_COUNT) issue();
+            
+        });
+        
+    };
+    for(std::size_t i = 0; i < CONCURRENCY; ++i) issue();
+    executor.run();
+    
+    std::chrono::duration<double> time = finish - start;
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+        << completed / time.count() << " req/s, failed: " << failed << std::endl;
+    return !failed && completed == REQUEST_COUNT;
+    
+}
+
+
+int main() {
+    
+    try {
+        
+        IOExecutor serverExecutor;
+        HTTPServer server(serverExecutor, [](auto&, auto& response) { response.setBody("Hello, World!"); });
+        server.listen(IPv4Address::getLoopback(), 12345);
+        std::thread serverThread([&]() { serverExecutor.run(); });
+        
+        bool success = benchmark("Connection per request", false, 1);
+        success = benchmark("Keep-alive", true, 1) && success;
+        success = benchmark("Keep-alive pipelined", true, 8) && success;
+        
+        serverExecutor.execute([&]() { server.close(); });
+        serverThread.join();
+        if(!success) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,167 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t CONNECTION_COUNT = 64;
+constexpr std::size_t REQUEST_COUNT = 2000;
+constexpr std::size_t PIPELINE_DEPTH = 8;
+constexpr std::size_t BUFFER_SIZE = 65536;
+
+
+struct Client {
+    
+    TCPSocket socket;
+    HTTPParser parser;
+    std::vector<Byte> buffer;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::size_t pending = 0;
+    std::size_t completed = 0;
+    decltype(HighResolutionClock::now()) start;
+    
+    Client(IOExecutor& executor) : socket(executor), buffer(BUFFER_SIZE) {}
+    
+};
+
+
+int main() {
+    
+    try {
+        
+        IOExecutor serverExecutor;
+        HTTPServer server(serverExecutor, [](auto& request, auto& response) {
+            
+            response.setHeader("Content-Type", "text/plain");
+            response.setBody(request.getTarget() == "/" ? "Hello, World!" : "Not Found");
+            if(request.getTarget() != "/") response.setStatus(404);
+            
+        });
+        server.listen(IPv4Address::getLoopback(), 12345);
+        std::thread serverThread([&]() { serverExecutor.run(); });
+        
+        IOExecutor executor;
+        std::vector<std::unique_ptr<Client>> clients;
+        std::vector<double> latencies;
+        std::size_t failed = 0;
+        std::string batch;
+        for(std::size_t i = 0; i < PIPELINE_DEPTH; ++i) batch += "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        
+        std::function<void(Client&)> send, receive;
+        send = [&](Client& client) {
+            
+            client.pending = PIPELINE_DEPTH;
+            client.start = HighResolutionClock::now();
+            client.socket.writeAll(batch.data(), batch.size(), [&](auto& e, auto) { if(e) { ++failed; client.socket.close(); } });
+            
+        };
+        receive = [&](Client& client) {
+            
+            if(client.begin == client.end) client.begin = client.end = 0;
+            else if(client.end == client.buffer.size()) {
+                
+                std::memmove(client.buffer.data(), client.buffer.data() + client.begin, client.end - client.begin);
+                client.end -= client.begin, client.begin = 0;
+                
+            }
+            client.socket.read(client.buffer.data() + client.end, client.buffer.size() - client.end, [&](auto& e, auto n) {
+                
+                if(e || !n) { ++failed; return; }
+                client.end += n;
+                for(;;) {
+                    
+                    HTTPResponse response;
+                    ExceptionPtr error;
+                    auto count = client.parser.parseResponse(client.buffer.data() + client.begin, client.end - client.begin, response, false, false, error);
+                    if(error || (count && response.getStatus() != 200)) { ++failed; client.socket.close(); return; }
+                    if(!count) break;
+                    client.begin += count;
+                    std::chrono::duration<double, std::micro> time = HighResolutionClock::now() - client.start;
+                    latencies.push_back(time.count());
+                    ++client.completed;
+                    if(--client.pending) continue;
+                    if(client.completed == REQUEST_COUNT) { client.socket.close(); return; }
+                    send(client);
+                    
+                }
+                receive(client);
+                
+            });
+            
+        };
+        
+        auto start = HighResolutionClock::now();
+        for(std::size_t i = 0; i < CONNECTION_COUNT; ++i) {
+            
+            clients.emplace_back(new Client(executor));
+            auto& client = *clients.back();
+            client.socket.connect(IPv4Address::getLoopback(), 12345, [&](auto& e) {
+                
+                if(e) { ++failed; return; }
+                client.socket.setOption(TCPOption::noDelay());
+                send(client);
+                receive(client);
+                
+            });
+            
+        }
+        executor.run();
+        std::chrono::duration<double> time = HighResolutionClock::now() - start;
+        
+        serverExecutor.execute([&]() { server.close(); });
+        serverThread.join();
+        
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) { return latencies.empty() ? 0.0 : latencies[std::size_t(p * (latencies.size() - 1))]; };
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "Requests: " << latencies.size() << ", failed: " << failed << std::endl;
+        std::cout << "Throughput: " << latencies.size() / time.count() << " req/s" << std::endl;
+        std::cout << "Latency: p50 " << percentile(0.5) << " us, p99 " << percentile(0.99) << " us" << std::endl;
+        if(failed || latencies.size() != CONNECTION_COUNT * REQUEST_COUNT) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
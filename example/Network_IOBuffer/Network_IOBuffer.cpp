@@ -0,0 +1,104 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstring>
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "Cats/Corecat/Util/Endian.hpp"
+#include "Cats/Netycat/IOBuffer.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Netycat;
+
+
+void runServer() {
+    
+    try {
+        
+        TCPServer server;
+        TCPSocket socket;
+        IOBuffer buffer;
+        
+        server.listen(12345);
+        server.accept(socket);
+        while(buffer.getSize() < 4) socket.read(buffer, 4096);
+        std::uint32_t length;
+        buffer.copyTo(&length, sizeof(length));
+        length = Cats::Corecat::convertBigToNative(length);
+        buffer.trimFront(sizeof(length));
+        while(buffer.getSize() < length) socket.read(buffer, 4096);
+        auto message = buffer.split(length);
+        std::cout << "Server read " << message.getSize() << " bytes in " << message.getSegmentCount() << " segment(s): ";
+        for(std::size_t i = 0; i < message.getSegmentCount(); ++i)
+            std::cout.write(reinterpret_cast<const char*>(message.getSegmentData(i)), message.getSegmentSize(i));
+        std::cout << std::endl;
+        socket.write(message);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+void runClient() {
+    
+    try {
+        
+        TCPSocket socket;
+        
+        IOBuffer message("Hello, ", 7, 16);
+        message.append(IOBuffer("Netycat!", 8));
+        std::uint32_t length = Cats::Corecat::convertNativeToBig(std::uint32_t(message.getSize()));
+        std::memcpy(message.prepend(sizeof(length)), &length, sizeof(length));
+        std::cout << "Client write " << message.getSize() << " bytes in " << message.getSegmentCount() << " segment(s)" << std::endl;
+        
+        socket.connect(IPv4Address::getLoopback(), 12345);
+        socket.write(message);
+        IOBuffer reply;
+        while(reply.getSize() < message.getSize() - sizeof(length)) socket.read(reply, 4096);
+        std::string s(reply.getSize(), '\0');
+        reply.copyTo(&s[0], s.size());
+        std::cout << "Client read: " << s << std::endl;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+
+int main() {
+    
+    try {
+        
+        std::thread(runServer).detach();
+        runClient();
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,186 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Cats/Corecat/System/OS.hpp"
+#include "Cats/Corecat/Text/Formatter.hpp"
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Network/IP.hpp"
+
+#if defined(CORECAT_OS_WINDOWS)
+#   include "Cats/Netycat/Network/Win32/WSA.hpp"
+#else
+#   include <arpa/inet.h>
+#endif
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t ADDRESS_COUNT = 1000000;
+
+
+template <typename F>
+void benchmark(const char* name, std::size_t count, F f) {
+    
+    volatile std::size_t sink = 0;
+    auto start = HighResolutionClock::now();
+    sink += f();
+    std::chrono::duration<double, std::nano> time = HighResolutionClock::now() - start;
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+        << time.count() / double(count) << " ns/address" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        std::mt19937 random;
+        String8 buffer4, buffer6;
+        std::vector<std::pair<std::size_t, std::size_t>> lines4, lines6;
+        for(std::size_t i = 0; i < ADDRESS_COUNT; ++i) {
+            
+            auto v4 = IPv4Address(std::uint32_t(random())).toString();
+            lines4.emplace_back(buffer4.getLength(), v4.getLength());
+            buffer4 += v4, buffer4 += '\n';
+            
+            auto v6 = "2001:db8:{:x}::{:x}:{:x}"_format(random() & 0xFFFF, random() & 0xFFFF, random() & 0xFFFF);
+            lines6.emplace_back(buffer6.getLength(), v6.getLength());
+            buffer6 += v6, buffer6 += '\n';
+            
+        }
+        
+        benchmark("IPv4Address::tryParse", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            IPv4Address address;
+            for(auto&& x : lines4) n += IPv4Address::tryParse(buffer4.getData() + x.first, x.second, address);
+            return n;
+        });
+        benchmark("inet_pton(AF_INET)", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            char str[16];
+            in_addr address;
+            for(auto&& x : lines4) {
+                std::memcpy(str, buffer4.getData() + x.first, x.second), str[x.second] = 0;
+                n += ::inet_pton(AF_INET, str, &address) == 1;
+            }
+            return n;
+        });
+        benchmark("IPv6Address::tryParse", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            IPv6Address address;
+            for(auto&& x : lines6) n += IPv6Address::tryParse(buffer6.getData() + x.first, x.second, address);
+            return n;
+        });
+        benchmark("inet_pton(AF_INET6)", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            char str[64];
+            in6_addr address;
+            for(auto&& x : lines6) {
+                std::memcpy(str, buffer6.getData() + x.first, x.second), str[x.second] = 0;
+                n += ::inet_pton(AF_INET6, str, &address) == 1;
+            }
+            return n;
+        });
+        std::vector<IPv4Address> addresses4;
+        std::vector<IPv6Address> addresses6;
+        for(auto&& x : lines4) addresses4.push_back(IPv4Address::parse(buffer4.getData() + x.first, x.second));
+        for(auto&& x : lines6) addresses6.push_back(IPv6Address::parse(buffer6.getData() + x.first, x.second));
+        
+        benchmark("IPv4Address::formatTo", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            char str[IPv4Address::MAX_STRING_LENGTH];
+            for(auto&& x : addresses4) n += x.formatTo(str);
+            return n;
+        });
+        benchmark("IPv4Address::toString", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            for(auto&& x : addresses4) n += x.toString().getLength();
+            return n;
+        });
+        benchmark("_format (IPv4)", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            for(auto&& x : addresses4) {
+                auto d = x.getData();
+                n += "{}.{}.{}.{}"_format(d[0], d[1], d[2], d[3]).getLength();
+            }
+            return n;
+        });
+        benchmark("IPv6Address::formatTo", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            char str[IPv6Address::MAX_STRING_LENGTH];
+            for(auto&& x : addresses6) n += x.formatTo(str);
+            return n;
+        });
+        benchmark("IPv6Address::toString", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            for(auto&& x : addresses6) n += x.toString().getLength();
+            return n;
+        });
+        benchmark("_format (IPv6)", ADDRESS_COUNT, [&] {
+            std::size_t n = 0;
+            for(auto&& x : addresses6) {
+                auto d = x.getData();
+                n += "{:x}:{:x}:{:x}:{:x}:{:x}:{:x}:{:x}:{:x}%{}"_format(
+                    (std::uint16_t(d[0]) << 8) | d[1], (std::uint16_t(d[2]) << 8) | d[3],
+                    (std::uint16_t(d[4]) << 8) | d[5], (std::uint16_t(d[6]) << 8) | d[7],
+                    (std::uint16_t(d[8]) << 8) | d[9], (std::uint16_t(d[10]) << 8) | d[11],
+                    (std::uint16_t(d[12]) << 8) | d[13], (std::uint16_t(d[14]) << 8) | d[15],
+                    x.getScope()).getLength();
+            }
+            return n;
+        });
+        
+        for(std::size_t i = 0; i < ADDRESS_COUNT; ++i) {
+            
+            char str[IPv6Address::MAX_STRING_LENGTH];
+            if(IPv4Address::parse(str, addresses4[i].formatTo(str)) != addresses4[i]) throw IOException("IPv4 round trip failed");
+            if(IPv6Address::parse(str, addresses6[i].formatTo(str)) != addresses6[i]) throw IOException("IPv6 round trip failed");
+            
+        }
+        
+        benchmark("IPAddress::parseMany", ADDRESS_COUNT * 2, [&] {
+            std::vector<IPAddress> addresses;
+            addresses.reserve(ADDRESS_COUNT * 2);
+            auto invalid = IPAddress::parseMany(buffer4.getData(), buffer4.getLength(), addresses);
+            invalid += IPAddress::parseMany(buffer6.getData(), buffer6.getLength(), addresses);
+            if(invalid || addresses.size() != ADDRESS_COUNT * 2) throw IOException("Parse failed");
+            return addresses.size();
+        });
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,151 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Network/IP.hpp"
+#include "Cats/Netycat/Network/TCP.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t KEY_COUNT = 4096;
+constexpr std::size_t OPERATION_COUNT = 2000000;
+constexpr std::size_t VERIFY_INTERVAL = 65536;
+
+
+struct ClusteredHash {
+    
+    std::size_t operator ()(const TCPEndpoint& endpoint) const noexcept {
+        
+        return std::size_t(endpoint.getHash()) & ~std::size_t(15);
+        
+    }
+    
+};
+
+
+template <typename H>
+void verify(const IPHashMap<TCPEndpoint, std::uint32_t, H>& map, const std::unordered_map<TCPEndpoint, std::uint32_t>& reference) {
+    
+    if(map.getSize() != reference.size()) throw IOException("Size mismatch");
+    std::size_t count = 0;
+    for(auto&& x : map) {
+        
+        auto it = reference.find(x.first);
+        if(it == reference.end() || it->second != x.second) throw IOException("Iteration mismatch");
+        ++count;
+        
+    }
+    if(count != reference.size()) throw IOException("Iteration count mismatch");
+    
+}
+
+template <typename H>
+void check(const char* name, const std::vector<TCPEndpoint>& keys) {
+    
+    std::mt19937 random(1);
+    IPHashMap<TCPEndpoint, std::uint32_t, H> map;
+    std::unordered_map<TCPEndpoint, std::uint32_t> reference;
+    for(std::size_t i = 0; i < OPERATION_COUNT; ++i) {
+        
+        auto& key = keys[random() % keys.size()];
+        auto value = std::uint32_t(random());
+        switch(random() % 4) {
+        case 0: {
+            
+            auto inserted = map.emplace(key, value).second;
+            if(inserted != reference.emplace(key, value).second) throw IOException("Emplace mismatch");
+            break;
+            
+        }
+        case 1: map[key] = value, reference[key] = value; break;
+        case 2: if(map.erase(key) != (reference.erase(key) != 0)) throw IOException("Erase mismatch"); break;
+        default: {
+            
+            auto p = map.find(key);
+            auto it = reference.find(key);
+            if(it == reference.end() ? p != nullptr : !p || *p != it->second) throw IOException("Lookup mismatch");
+            break;
+            
+        }
+        }
+        if(i % VERIFY_INTERVAL == 0) verify(map, reference);
+        
+    }
+    verify(map, reference);
+    for(auto&& key : keys) {
+        
+        map.erase(key), reference.erase(key);
+        if(map.contains(key)) throw IOException("Erase mismatch");
+        
+    }
+    verify(map, reference);
+    std::cout << name << ": " << OPERATION_COUNT << " operations agreed" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        std::mt19937 random;
+        std::vector<TCPEndpoint> keys;
+        for(std::size_t i = 0; i < KEY_COUNT; ++i) {
+            
+            if(i % 4) {
+                
+                IPv4Address v4 = std::uint32_t(random());
+                if(IPAddress(v4).getHash() != v4.getHash()) throw IOException("IPv4 hash mismatch");
+                keys.emplace_back(v4, std::uint16_t(random()));
+                
+            } else {
+                
+                std::uint8_t data[16] = {0x20, 0x01, 0x0D, 0xB8};
+                for(std::size_t j = 8; j < 16; ++j) data[j] = std::uint8_t(random());
+                IPv6Address v6(data);
+                if(IPAddress(v6).getHash() != v6.getHash()) throw IOException("IPv6 hash mismatch");
+                keys.emplace_back(v6, std::uint16_t(random()));
+                
+            }
+            if(std::hash<TCPEndpoint>()(keys.back()) != std::size_t(keys.back().getHash())) throw IOException("Endpoint hash mismatch");
+            
+        }
+        
+        check<std::hash<TCPEndpoint>>("IPHashMap", keys);
+        check<ClusteredHash>("IPHashMap (clustered hash)", keys);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
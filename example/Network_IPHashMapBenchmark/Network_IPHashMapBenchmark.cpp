@@ -0,0 +1,102 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Network/IP.hpp"
+#include "Cats/Netycat/Network/TCP.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t ENDPOINT_COUNT = 1000000;
+constexpr std::size_t ROUND_COUNT = 10;
+
+
+template <typename M>
+void benchmark(const char* name, const std::vector<TCPEndpoint>& endpoints) {
+    
+    M map;
+    for(std::size_t i = 0; i < endpoints.size(); ++i) map[endpoints[i]] = std::uint32_t(i);
+    
+    volatile std::size_t sink = 0;
+    auto start = HighResolutionClock::now();
+    for(std::size_t i = 0; i < ROUND_COUNT; ++i)
+        for(auto&& x : endpoints) sink += map[x];
+    std::chrono::duration<double, std::nano> time = HighResolutionClock::now() - start;
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+        << time.count() / double(ROUND_COUNT * endpoints.size()) << " ns/lookup" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        std::mt19937 random;
+        std::vector<TCPEndpoint> endpoints;
+        for(std::size_t i = 0; i < ENDPOINT_COUNT; ++i) {
+            
+            if(i % 4) endpoints.emplace_back(IPv4Address(std::uint32_t(random())), std::uint16_t(random()));
+            else {
+                
+                std::uint8_t data[16] = {0x20, 0x01, 0x0D, 0xB8};
+                for(std::size_t j = 8; j < 16; ++j) data[j] = std::uint8_t(random());
+                endpoints.emplace_back(IPv6Address(data), std::uint16_t(random()));
+                
+            }
+            
+        }
+        
+        benchmark<IPHashMap<TCPEndpoint, std::uint32_t>>("IPHashMap", endpoints);
+        benchmark<std::unordered_map<TCPEndpoint, std::uint32_t>>("std::unordered_map", endpoints);
+        benchmark<std::map<TCPEndpoint, std::uint32_t>>("std::map", endpoints);
+        
+        IPHashMap<TCPEndpoint, std::uint32_t> map;
+        for(std::size_t i = 0; i < endpoints.size(); ++i) map[endpoints[i]] = std::uint32_t(i);
+        for(std::size_t i = 0; i < endpoints.size(); i += 2) map.erase(endpoints[i]);
+        for(std::size_t i = 0; i < endpoints.size(); ++i) {
+            
+            auto p = map.find(endpoints[i]);
+            if(i % 2 ? !p || *p != i : p != nullptr) throw IOException("Lookup mismatch");
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
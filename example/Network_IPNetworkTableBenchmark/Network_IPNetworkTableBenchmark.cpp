@@ -0,0 +1,148 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util.hpp"
+#include "Cats/Netycat/Network/IP.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t NETWORK_COUNT = 1000000;
+constexpr std::size_t ADDRESS_COUNT = 1000000;
+constexpr std::size_t ROUND_COUNT = 10;
+
+
+class LinearTable {
+    
+private:
+    
+    std::vector<IPHashMap<IPAddress, std::uint32_t>> maps;
+    
+public:
+    
+    LinearTable(const std::vector<std::pair<IPNetwork, std::uint32_t>>& networks) : maps(129 * 2) {
+        
+        for(auto&& x : networks)
+            maps[x.first.getPrefixLength() * 2 + x.first.getAddress().isIPv6()][x.first.getAddress()] = x.second;
+        
+    }
+    
+    const std::uint32_t* find(const IPAddress& address) const {
+        
+        auto type = std::size_t(address.isIPv6());
+        for(auto length = IPNetwork(address, 0).getMaxPrefixLength() + 1; length--; ) {
+            
+            auto&& map = maps[length * 2 + type];
+            if(map.isEmpty()) continue;
+            if(auto p = map.find(IPNetwork(address, length).getAddress())) return p;
+            
+        }
+        return nullptr;
+        
+    }
+    
+};
+
+
+template <typename T>
+void benchmark(const char* name, const T& table, const std::vector<IPAddress>& addresses) {
+    
+    volatile std::size_t sink = 0;
+    auto start = HighResolutionClock::now();
+    for(std::size_t i = 0; i < ROUND_COUNT; ++i)
+        for(auto&& x : addresses) if(auto p = table.find(x)) sink += *p;
+    std::chrono::duration<double, std::nano> time = HighResolutionClock::now() - start;
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+        << time.count() / double(ROUND_COUNT * addresses.size()) << " ns/lookup" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        std::mt19937 random;
+        std::vector<std::pair<IPNetwork, std::uint32_t>> networks;
+        for(std::size_t i = 0; i < NETWORK_COUNT; ++i) {
+            
+            if(i % 4) networks.emplace_back(IPNetwork(IPv4Address(std::uint32_t(random())), random() % 8 ? 24 : 16 + random() % 8), std::uint32_t(i));
+            else {
+                
+                std::uint8_t data[16] = {0x20, 0x01};
+                for(std::size_t j = 2; j < 16; ++j) data[j] = std::uint8_t(random());
+                networks.emplace_back(IPNetwork(IPv6Address(data), random() % 2 ? 48 : 29 + random() % 19), std::uint32_t(i));
+                
+            }
+            
+        }
+        std::vector<IPAddress> addresses4, addresses6;
+        for(std::size_t i = 0; i < ADDRESS_COUNT; ++i) {
+            
+            addresses4.emplace_back(IPv4Address(std::uint32_t(random())));
+            auto data = networks[random() % (NETWORK_COUNT / 4) * 4].first.getAddress().getIPv6();
+            for(std::size_t j = 6; j < 16; ++j) data.getData()[j] ^= std::uint8_t(random());
+            addresses6.emplace_back(data);
+            
+        }
+        
+        auto start = HighResolutionClock::now();
+        IPNetworkTable<std::uint32_t> table(networks);
+        std::chrono::duration<double, std::milli> time = HighResolutionClock::now() - start;
+        std::cout << std::left << std::setw(28) << "IPNetworkTable build" << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+            << time.count() << " ms" << std::endl;
+        LinearTable linear(networks);
+        
+        benchmark("IPNetworkTable IPv4", table, addresses4);
+        benchmark("IPNetworkTable IPv6", table, addresses6);
+        benchmark("IPHashMap per length IPv4", linear, addresses4);
+        benchmark("IPHashMap per length IPv6", linear, addresses6);
+        
+        for(auto&& addresses : {&addresses4, &addresses6}) {
+            
+            for(auto&& x : *addresses) {
+                
+                auto p = table.find(x), q = linear.find(x);
+                if(!p != !q || (p && *p != *q)) throw IOException("Lookup mismatch");
+                
+            }
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,133 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t REQUEST_COUNT = 10000;
+constexpr std::size_t CONCURRENCY = 16;
+constexpr std::size_t MIN_SIZE = 4;
+constexpr std::size_t MAX_SIZE = 8;
+
+
+int main() {
+    
+    try {
+        
+        IOExecutor serverExecutor;
+        TCPServer server(serverExecutor);
+        std::function<void(std::shared_ptr<TCPSocket>, std::shared_ptr<char>)> echo = [&](auto socket, auto buffer) {
+            
+            socket->readAll(buffer.get(), 1, [&, socket, buffer](auto& e, auto) {
+                
+                if(e) return;
+                socket->writeAll(buffer.get(), 1, [&, socket, buffer](auto& e, auto) { if(!e) echo(socket, buffer); });
+                
+            });
+            
+        };
+        server.listen(12345);
+        server.acceptLoop([&](auto& e, auto& socket) {
+            
+            if(!e) echo(std::make_shared<TCPSocket>(std::move(socket)), std::make_shared<char>());
+            
+        });
+        std::thread serverThread([&]() { serverExecutor.run(); });
+        
+        IOExecutor executor;
+        TCPConnectionPool pool(MIN_SIZE, MAX_SIZE, 1.0);
+        TCPEndpoint endpoint(IPv4Address::getLoopback(), 12345);
+        std::size_t issued = 0, completed = 0, failed = 0, maxSize = 0;
+        auto start = HighResolutionClock::now(), finish = start;
+        
+        std::function<void()> issue;
+        auto next = [&]() {
+            
+            if(++completed == REQUEST_COUNT) { finish = HighResolutionClock::now(); pool.close(); }
+            else if(issued < REQUEST_COUNT) issue();
+            
+        };
+        issue = [&]() {
+            
+            ++issued;
+            pool.checkout(executor, endpoint, [&](auto& e, auto socket) {
+                
+                if(e) { ++failed; next(); return; }
+                auto size = pool.getSize(executor, endpoint);
+                if(size > maxSize) maxSize = size;
+                auto lease = std::make_shared<TCPConnectionPool::SocketPtr>(std::move(socket));
+                auto buffer = std::make_shared<char>('x');
+                (*lease)->writeAll(buffer.get(), 1, [&, lease, buffer](auto& e, auto) {
+                    
+                    if(e) { (*lease)->close(); lease->reset(); ++failed; next(); return; }
+                    (*lease)->readAll(buffer.get(), 1, [&, lease, buffer](auto& e, auto) {
+                        
+                        if(e || *buffer != 'x') { (*lease)->close(); ++failed; }
+                        lease->reset();
+                        next();
+                        
+                    });
+                    
+                });
+                
+            });
+            
+        };
+        
+        pool.warmUp(executor, endpoint, [&](auto& e) {
+            
+            if(e) { std::cerr << "Warm-up failed" << std::endl; pool.close(); return; }
+            std::cout << "Warmed up: " << pool.getIdleCount(executor, endpoint) << " connections" << std::endl;
+            start = HighResolutionClock::now();
+            for(std::size_t i = 0; i < CONCURRENCY; ++i) issue();
+            
+        });
+        executor.run();
+        std::chrono::duration<double> time = finish - start;
+        
+        serverExecutor.execute([&]() { server.close(); });
+        serverThread.join();
+        
+        std::cout << "Requests: " << completed << ", failed: " << failed << ", max pool size: " << maxSize << std::endl;
+        std::cout << "Rate: " << double(completed) / time.count() << " requests/s" << std::endl;
+        if(failed || completed != REQUEST_COUNT || maxSize > MAX_SIZE) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,102 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstring>
+
+#include <iostream>
+#include <thread>
+
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t FRAME_COUNT = 3;
+
+
+void runServer(TCPFrameCodec codec, std::uint16_t port) {
+    
+    try {
+        
+        TCPServer server;
+        TCPSocket socket;
+        
+        server.listen(port);
+        server.accept(socket);
+        TCPFrameReader reader(socket, codec);
+        for(std::size_t i = 0; i < FRAME_COUNT; ++i) {
+            
+            const Cats::Corecat::Byte* data;
+            auto size = reader.read(data);
+            (std::cout << "Server read frame: ").write(reinterpret_cast<const char*>(data), size) << std::endl;
+            socket.write(codec.encode(data, size));
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+void runClient(TCPFrameCodec codec, std::uint16_t port) {
+    
+    try {
+        
+        TCPSocket socket;
+        const char* messages[FRAME_COUNT] = {"Hello, Netycat!", "", "Framed message"};
+        
+        socket.connect(IPv4Address::getLoopback(), port);
+        IOBuffer buffer;
+        for(auto message : messages) buffer.append(codec.encode(message, std::strlen(message)));
+        socket.write(buffer);
+        TCPFrameReader reader(socket, codec);
+        for(std::size_t i = 0; i < FRAME_COUNT; ++i) {
+            
+            const Cats::Corecat::Byte* data;
+            auto size = reader.read(data);
+            (std::cout << "Client read frame: ").write(reinterpret_cast<const char*>(data), size) << std::endl;
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+
+int main() {
+    
+    try {
+        
+        std::thread(runServer, TCPFrameCodec::varintLength(), 12345).detach();
+        runClient(TCPFrameCodec::varintLength(), 12345);
+        std::thread(runServer, TCPFrameCodec::delimited("\r\n", 2), 12346).detach();
+        runClient(TCPFrameCodec::delimited("\r\n", 2), 12346);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,108 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Corecat;
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t ROUND_COUNT = 20;
+constexpr std::size_t MESSAGE_SIZE = 64;
+
+
+void runServer(TCPServer& server) {
+    
+    try {
+        
+        TCPSocket socket;
+        char buffer[MESSAGE_SIZE];
+        std::uint32_t size;
+        
+        server.accept(socket);
+        for(std::size_t i = 0; i < ROUND_COUNT; ++i) {
+            
+            socket.readAll(&size, sizeof(size));
+            socket.readAll(buffer, size);
+            socket.writeAll(&size, sizeof(size));
+            socket.writeAll(buffer, size);
+            
+        }
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+    
+}
+
+void benchmark(const char* name, bool noDelay, std::uint16_t port) {
+    
+    TCPServer server;
+    server.setOption(TCPOption::noDelay(noDelay));
+    server.listen(IPv4Address::getLoopback(), port);
+    std::thread thread(runServer, std::ref(server));
+    
+    TCPSocket socket;
+    char buffer[MESSAGE_SIZE] = {};
+    std::uint32_t size = MESSAGE_SIZE;
+    
+    socket.connect(IPv4Address::getLoopback(), port);
+    socket.setOption(TCPOption::noDelay(noDelay));
+    auto start = HighResolutionClock::now();
+    for(std::size_t i = 0; i < ROUND_COUNT; ++i) {
+        
+        socket.writeAll(&size, sizeof(size));
+        socket.writeAll(buffer, size);
+        socket.readAll(&size, sizeof(size));
+        socket.readAll(buffer, size);
+        
+    }
+    std::chrono::duration<double, std::micro> time = HighResolutionClock::now() - start;
+    thread.join();
+    
+    std::cout << std::left << std::setw(16) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+        << time.count() / double(ROUND_COUNT) << " us/round trip" << std::endl;
+    
+}
+
+int main() {
+    
+    try {
+        
+        benchmark("Nagle", false, 12345);
+        benchmark("TCP_NODELAY", true, 12346);
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,104 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cstring>
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t CONNECTION_COUNT = 1000;
+constexpr std::size_t ACCEPT_COUNT = 64;
+
+
+int main() {
+    
+    try {
+        
+        IOExecutor executor;
+        TCPServer server(executor);
+        std::vector<TCPSocket> accepted, clients;
+        std::size_t failed = 0, closed = 0, byteCount = 0;
+        const char message[] = "Hello, Netycat!";
+        
+        accepted.reserve(CONNECTION_COUNT);
+        std::function<void(TCPSocket&)> read = [&](TCPSocket& socket) {
+            
+            socket.readPooled([&](auto& e, auto& buffer) {
+                
+                if(e || buffer.isEmpty()) {
+                    
+                    if(++closed + failed == CONNECTION_COUNT) server.close();
+                    return;
+                    
+                }
+                byteCount += buffer.getSize();
+                read(socket);
+                
+            });
+            
+        };
+        
+        server.listen(IPv4Address::getLoopback(), 12345, CONNECTION_COUNT);
+        server.acceptLoop([&](auto& e, auto& socket) {
+            
+            if(e) return;
+            accepted.push_back(std::move(socket));
+            read(accepted.back());
+            
+        }, ACCEPT_COUNT);
+        
+        clients.reserve(CONNECTION_COUNT);
+        for(std::size_t i = 0; i < CONNECTION_COUNT; ++i) {
+            
+            clients.emplace_back(executor);
+            auto& client = clients.back();
+            client.connect(IPv4Address::getLoopback(), 12345, [&](auto& e) {
+                
+                if(e) { if(closed + ++failed == CONNECTION_COUNT) server.close(); return; }
+                client.writeAll(message, std::strlen(message), [&](auto&, auto) { client.close(); });
+                
+            });
+            
+        }
+        executor.run();
+        
+        auto& pool = executor.getBufferPool();
+        std::cout << "Connections: " << closed << ", failed: " << failed << ", bytes: " << byteCount << std::endl;
+        std::cout << "Pool buffers: " << pool.getBufferCount() << " x " << pool.getBufferSize() << " bytes" << std::endl;
+        if(closed + failed != CONNECTION_COUNT || byteCount != closed * std::strlen(message)) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
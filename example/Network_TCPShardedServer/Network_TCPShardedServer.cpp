@@ -0,0 +1,103 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t SHARD_COUNT = 4;
+constexpr std::size_t CLIENT_COUNT = 4;
+constexpr std::size_t CONNECTION_COUNT = 250;
+
+
+int main() {
+    
+    try {
+        
+        TCPShardedServer server(SHARD_COUNT);
+        std::vector<std::atomic<std::size_t>> counts(server.getShardCount());
+        
+        server.listen(12345);
+        server.start([&](auto& e, auto& executor, auto& s) {
+            
+            if(e) return;
+            for(std::size_t i = 0; i < server.getShardCount(); ++i)
+                if(&server.getExecutor(i) == &executor) ++counts[i];
+            auto socket = std::make_shared<TCPSocket>(std::move(s));
+            auto buffer = std::make_shared<char>();
+            socket->readAll(buffer.get(), 1, [=](auto& e, auto) {
+                
+                if(!e) socket->writeAll(buffer.get(), 1, [=](auto&, auto) {});
+                
+            });
+            
+        });
+        
+        std::atomic<std::size_t> echoed{};
+        std::vector<std::thread> clients;
+        for(std::size_t i = 0; i < CLIENT_COUNT; ++i) {
+            
+            clients.emplace_back([&]() {
+                
+                try {
+                    
+                    for(std::size_t j = 0; j < CONNECTION_COUNT; ++j) {
+                        
+                        TCPSocket socket;
+                        char c = char(j);
+                        socket.connect(IPv4Address::getLoopback(), 12345);
+                        socket.writeAll(&c, 1);
+                        socket.readAll(&c, 1);
+                        if(c == char(j)) ++echoed;
+                        
+                    }
+                    
+                } catch(std::exception& e) { std::cerr << e.what() << std::endl; }
+                
+            });
+            
+        }
+        for(auto&& x : clients) x.join();
+        server.stop();
+        server.join();
+        
+        for(std::size_t i = 0; i < counts.size(); ++i) std::cout << "Shard " << i << ": " << counts[i] << " connections" << std::endl;
+        std::cout << "Echoed: " << echoed << std::endl;
+        if(echoed != CLIENT_COUNT * CONNECTION_COUNT) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
@@ -0,0 +1,114 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "Cats/Netycat/Network.hpp"
+
+
+using namespace Cats::Netycat;
+
+
+constexpr std::size_t CHUNK_SIZE = 16384;
+constexpr std::size_t TOTAL_SIZE = 64 * 1048576;
+
+
+int main() {
+    
+    try {
+        
+        IOExecutor executor;
+        TCPServer server(executor);
+        TCPSocket socket(executor), client(executor);
+        std::unique_ptr<TCPWriteQueue> queue;
+        std::vector<char> chunk(CHUNK_SIZE, 'x');
+        std::size_t written = 0, received = 0, pauseCount = 0, maxQueued = 0;
+        
+        auto produce = [&]() {
+            
+            while(written < TOTAL_SIZE) {
+                
+                written += CHUNK_SIZE;
+                bool writable = queue->write(chunk.data(), CHUNK_SIZE);
+                if(queue->getSize() > maxQueued) maxQueued = queue->getSize();
+                if(written == TOTAL_SIZE) {
+                    
+                    queue->flush([&](auto& e) {
+                        
+                        if(e) std::cerr << "Flush failed" << std::endl;
+                        socket.close();
+                        
+                    });
+                    
+                }
+                if(!writable) return;
+                
+            }
+            
+        };
+        
+        server.listen(12345);
+        server.accept(socket, [&](auto& e) {
+            
+            server.close();
+            if(e) return;
+            queue.reset(new TCPWriteQueue(socket));
+            queue->setWritabilityCallback([&](bool writable) {
+                
+                if(!writable) ++pauseCount;
+                else produce();
+                
+            });
+            produce();
+            
+        });
+        
+        std::function<void()> consume = [&]() {
+            
+            client.readPooled([&](auto& e, auto& buffer) {
+                
+                if(e || buffer.isEmpty()) return;
+                received += buffer.getSize();
+                consume();
+                
+            });
+            
+        };
+        client.connect(IPv4Address::getLoopback(), 12345, [&](auto& e) { if(!e) consume(); });
+        executor.run();
+        
+        std::cout << "Sent: " << written << ", received: " << received << std::endl;
+        std::cout << "Paused: " << pauseCount << " times, max queued: " << maxQueued << " bytes" << std::endl;
+        if(received != TOTAL_SIZE || maxQueued >= TCPWriteQueue::DEFAULT_HIGH_WATERMARK + CHUNK_SIZE) return 1;
+        
+    } catch(std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+    
+    return 0;
+    
+}
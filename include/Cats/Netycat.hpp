@@ -28,7 +28,10 @@
 #define CATS_NETYCAT_HPP
 
 
+#include "Netycat/Awaitable.hpp"
 #include "Netycat/Filesystem.hpp"
+#include "Netycat/IOBuffer.hpp"
+#include "Netycat/IOBufferPool.hpp"
 #include "Netycat/IOExecutor.hpp"
 #include "Netycat/Network.hpp"
 
@@ -0,0 +1,125 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_AWAITABLE_HPP
+#define CATS_NETYCAT_AWAITABLE_HPP
+
+
+#include "IOExecutor.hpp"
+
+#if defined(NETYCAT_AWAITABLE)
+
+
+#include <coroutine>
+
+
+namespace Cats {
+namespace Netycat {
+
+class OperationAwaitable : public IOExecutor::Operation {
+    
+protected:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+    IOExecutor* executor;
+    std::coroutine_handle<> handle;
+    ExceptionPtr exception;
+    std::size_t count = 0;
+    
+public:
+    
+    OperationAwaitable(IOExecutor* executor_, CompleteFunction complete_, ExceptionPtr exception_ = {}) noexcept :
+        Operation(complete_), executor(executor_), exception(std::move(exception_)) {}
+    
+    bool await_ready() const noexcept { return bool(exception); }
+    
+protected:
+    
+    template <typename F>
+    bool suspend(std::coroutine_handle<> handle_, F f) noexcept {
+        
+        handle = handle_;
+        static_cast<OVERLAPPED&>(*this) = OVERLAPPED();
+        executor->beginWork();
+        f(exception);
+        if(exception) { executor->endWork(); return false; }
+        return true;
+        
+    }
+    
+    void rethrow() { if(exception) exception.rethrow(); }
+    
+    static void resume(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count) {
+        
+        auto self = static_cast<OperationAwaitable*>(operation);
+        executor.endWork();
+        self->exception = e;
+        self->count = count;
+        self->handle.resume();
+        
+    }
+    
+};
+
+class SleepAwaitable : public IOExecutor::Operation {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+    IOExecutor* executor;
+    double time;
+    std::coroutine_handle<> handle;
+    
+public:
+    
+    SleepAwaitable(IOExecutor& executor_, double time_) noexcept : Operation(&resume), executor(&executor_), time(time_) {}
+    
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle_) { handle = handle_; executor->wait(time, this); }
+    void await_resume() const noexcept {}
+    
+private:
+    
+    static void resume(IOExecutor&, Operation* operation, const ExceptionPtr&, std::size_t) {
+        
+        static_cast<SleepAwaitable*>(operation)->handle.resume();
+        
+    }
+    
+};
+
+inline SleepAwaitable IOExecutor::sleep(double time) noexcept { return {*this, time}; }
+
+}
+}
+
+
+#endif
+
+
+#endif
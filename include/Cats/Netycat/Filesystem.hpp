@@ -28,11 +28,20 @@
 #define CATS_NETYCAT_FILESYSTEM_HPP
 
 
+#include "Cats/Corecat/System/OS.hpp"
+
 #include "Filesystem/Directory.hpp"
-#include "Filesystem/File.hpp"
+#include "Filesystem/DirectoryWalker.hpp"
 #include "Filesystem/FileInfo.hpp"
 #include "Filesystem/FilePath.hpp"
-#include "Filesystem/MappedFile.hpp"
+#include "Filesystem/FilePathTable.hpp"
+
+#if defined(CORECAT_OS_WINDOWS)
+#   include "Filesystem/DirectoryWatcher.hpp"
+#   include "Filesystem/File.hpp"
+#   include "Filesystem/MappedFile.hpp"
+#   include "Filesystem/MappedRingBuffer.hpp"
+#endif
 
 
 #endif
@@ -33,7 +33,6 @@
 
 #include "FileInfo.hpp"
 #include "FilePath.hpp"
-#include "Cats/Corecat/Win32/Windows.hpp"
 
 
 namespace Cats {
@@ -49,6 +48,7 @@ public:
     private:
         
         friend Directory;
+        friend class DirectoryWalker;
         
     public:
         
@@ -58,25 +58,52 @@ public:
         using reference = value_type&;
         using iterator_category = std::input_iterator_tag;
         
-        struct FindDeleter { void operator ()(HANDLE handle) const noexcept; };
+        using StringViewType = FilePath::StringViewType;
+        
+#if defined(CORECAT_OS_LINUX)
+        static constexpr std::size_t BUFFER_SIZE = 65536;
+#endif
         
     private:
         
-        std::shared_ptr<void> handle;
+        struct State;
+        
+        std::shared_ptr<State> state;
         FilePath path;
-        FilePath name;
+        mutable FilePath name;
+        mutable bool nameValid = false;
+        mutable FileStatus status;
+        mutable bool statusValid = false;
         
     private:
         
         Iterator() = default;
         Iterator(const FilePath& path_);
+        Iterator(const FilePath& path_, const std::shared_ptr<void>& parent);
+        
+        void next();
         
     public:
         
-        const FilePath& operator *() const noexcept { return name; }
-        const FilePath* operator ->() const noexcept { return &name; }
-        Iterator& operator ++();
-        friend bool operator ==(const Iterator& a, const Iterator& b) noexcept { return a.handle == b.handle; }
+        const FilePath& operator *() const {
+            
+            if(!nameValid) {
+                
+                if(name.isEmpty()) name = path / FilePath(getName());
+                else name.replaceFilename(getName());
+                nameValid = true;
+                
+            }
+            return name;
+            
+        }
+        const FilePath* operator ->() const { return &**this; }
+        Iterator& operator ++() { next(); return *this; }
+        friend bool operator ==(const Iterator& a, const Iterator& b) noexcept { return a.state == b.state; }
+        
+        StringViewType getName() const noexcept;
+        FileType getType() const;
+        const FileStatus& getStatus() const;
         
     };
     
@@ -114,10 +141,11 @@ public:
         using reference = value_type&;
         using iterator_category = std::input_iterator_tag;
         
+        using StringViewType = FilePath::StringViewType;
+        
     private:
         
         std::vector<std::pair<Directory, Directory::Iterator>> stack;
-        FilePath name;
         
     private:
         
@@ -126,8 +154,8 @@ public:
         
     public:
         
-        const FilePath& operator *() const noexcept { return name; }
-        const FilePath* operator ->() const noexcept { return &name; }
+        const FilePath& operator *() const { return *stack.back().second; }
+        const FilePath* operator ->() const { return &**this; }
         Iterator& operator ++();
         friend bool operator ==(const Iterator& a, const Iterator& b) noexcept {
             
@@ -138,6 +166,11 @@ public:
             
         }
         
+        StringViewType getName() const noexcept { return stack.back().second.getName(); }
+        FileType getType() const { return stack.back().second.getType(); }
+        const FileStatus& getStatus() const { return stack.back().second.getStatus(); }
+        std::size_t getDepth() const noexcept { return stack.size() - 1; }
+        
     };
     
 private:
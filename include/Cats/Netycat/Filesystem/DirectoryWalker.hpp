@@ -0,0 +1,113 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_DIRECTORYWALKER_HPP
+#define CATS_NETYCAT_FILESYSTEM_DIRECTORYWALKER_HPP
+
+
+#include <cstddef>
+
+#include <functional>
+
+#include "Directory.hpp"
+#include "FileInfo.hpp"
+#include "FilePath.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+class DirectoryWalker {
+    
+public:
+    
+    class Entry {
+        
+    private:
+        
+        friend DirectoryWalker;
+        
+    public:
+        
+        using StringViewType = FilePath::StringViewType;
+        
+    private:
+        
+        const Directory::Iterator& iterator;
+        std::size_t depth;
+        
+    private:
+        
+        Entry(const Directory::Iterator& iterator_, std::size_t depth_) noexcept : iterator(iterator_), depth(depth_) {}
+        
+    public:
+        
+        Entry(const Entry& src) = delete;
+        Entry& operator =(const Entry& src) = delete;
+        
+        const FilePath& getPath() const { return *iterator; }
+        StringViewType getName() const noexcept { return iterator.getName(); }
+        FileType getType() const { return iterator.getType(); }
+        const FileStatus& getStatus() const { return iterator.getStatus(); }
+        std::size_t getDepth() const noexcept { return depth; }
+        
+    };
+    
+    using VisitCallback = std::function<bool(const Entry&)>;
+    
+private:
+    
+    struct Context;
+    
+private:
+    
+    std::size_t threadCount;
+    
+private:
+    
+    static void process(Context& context, std::size_t index);
+    static void run(Context& context, std::size_t index);
+    
+public:
+    
+    DirectoryWalker(std::size_t threadCount_ = 0);
+    DirectoryWalker(const DirectoryWalker& src) = delete;
+    
+    DirectoryWalker& operator =(const DirectoryWalker& src) = delete;
+    
+    std::size_t getThreadCount() const noexcept { return threadCount; }
+    
+    void walk(const FilePath& path, VisitCallback cb);
+    
+};
+
+}
+}
+}
+
+
+#endif
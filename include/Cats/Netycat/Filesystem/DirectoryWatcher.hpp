@@ -0,0 +1,120 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_DIRECTORYWATCHER_HPP
+#define CATS_NETYCAT_FILESYSTEM_DIRECTORYWATCHER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Cats/Corecat/Concurrent/Promise.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+#include "Cats/Corecat/Win32/Handle.hpp"
+
+#include "FilePath.hpp"
+#include "../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+class DirectoryWatcher {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    using Handle = Corecat::Handle;
+    
+public:
+    
+    enum class EventType {
+        
+        ADDED,
+        REMOVED,
+        MODIFIED,
+        RENAMED,
+        QUEUE_OVERFLOW,
+        
+    };
+    
+    struct Event {
+        
+        EventType type;
+        FilePath name;
+        FilePath oldName;
+        
+    };
+    
+    using ReadCallback = std::function<void(const ExceptionPtr&, std::vector<Event>)>;
+    
+    static constexpr std::size_t BUFFER_SIZE = 65536;
+    
+private:
+    
+    IOExecutor* executor;
+    FilePath path;
+    bool recursive;
+    std::shared_ptr<std::uint32_t> buffer;
+    std::shared_ptr<bool> alive;
+    FilePath oldName;
+    Handle handle;
+    
+private:
+    
+    std::vector<Event> parse(std::size_t count);
+    
+public:
+    
+    DirectoryWatcher(IOExecutor& executor_, const FilePath& path_, bool recursive_ = false);
+    DirectoryWatcher(const DirectoryWatcher& src) = delete;
+    ~DirectoryWatcher();
+    
+    DirectoryWatcher& operator =(const DirectoryWatcher& src) = delete;
+    
+    const FilePath& getPath() const noexcept { return path; }
+    bool isRecursive() const noexcept { return recursive; }
+    
+    void read(ReadCallback cb) noexcept;
+    Promise<std::vector<Event>> readAsync() noexcept;
+    
+    void cancel() noexcept;
+    
+};
+
+}
+}
+}
+
+
+#endif
@@ -28,8 +28,12 @@
 #define CATS_NETYCAT_FILESYSTEM_FILEINFO_HPP
 
 
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
 #include "FilePath.hpp"
-#include "Cats/Corecat/Win32/Windows.hpp"
 
 
 namespace Cats {
@@ -42,6 +46,17 @@ enum class FileType {
     NOT_FOUND,
     FILE,
     DIRECTORY,
+    SYMLINK,
+    OTHER,
+    
+};
+
+struct FileStatus {
+    
+    FileType type;
+    std::uint64_t size;
+    std::int64_t modifyTime;
+    std::uint64_t inode;
     
 };
 
@@ -57,13 +72,23 @@ struct FileInfo {
     
     FileInfo() = delete;
     
-    static FileType getType(const FilePath& path);
+    static FileType getType(const FilePath& path, bool followSymlink = true);
     static bool isExists(const FilePath& path) { return getType(path) != FileType::NOT_FOUND; }
     static bool isFile(const FilePath& path) { return getType(path) == FileType::FILE; }
     static bool isDirectory(const FilePath& path) { return getType(path) == FileType::DIRECTORY; }
     
     static std::uint64_t getSize(const FilePath& path);
     
+    static FileStatus getStatus(const FilePath& path, bool followSymlink = true);
+    static void getStatus(const FilePath& base, const FilePath* paths, std::size_t count, FileStatus* statuses, bool followSymlink = true);
+    static std::vector<FileStatus> getStatus(const FilePath& base, const std::vector<FilePath>& paths, bool followSymlink = true) {
+        
+        std::vector<FileStatus> statuses(paths.size());
+        getStatus(base, paths.data(), paths.size(), statuses.data(), followSymlink);
+        return statuses;
+        
+    }
+    
     static SpaceInfo getSpace(const FilePath& path);
     
 };
@@ -34,8 +34,14 @@
 #include "Cats/Corecat/Util/Iterator.hpp"
 #include "Cats/Corecat/Util/Operator.hpp"
 
+#include "Impl/Separator.hpp"
+
 #if defined(CORECAT_OS_WINDOWS)
 #   include "Cats/Corecat/Win32/Windows.hpp"
+#elif defined(CORECAT_OS_LINUX) || defined(CORECAT_OS_MACOS)
+#   include <cerrno>
+#   include <cstring>
+#   include <unistd.h>
 #else
 #   error Unknown OS
 #endif
@@ -112,9 +118,10 @@ private:
         // Filename length
         if(rootLength != data.getLength()) {
             
-            auto p = b + rootDirectoryLength, q = e;
-            while(!isSeparator(q[-1]) && p != --q);
-            filenameLength = e - q;
+            const CharType* p = data.getData() + rootDirectoryLength;
+            const CharType* q = data.getData() + data.getLength();
+            auto s = Impl::findLastSeparator(p, q);
+            filenameLength = q - (s ? s + 1 : p);
             
         }
         
@@ -135,10 +142,16 @@ public:
     FilePath& operator /=(const FilePath& b) {
         
         if(b.isAbsolute() || (b.hasRoot() && getRootString() != b.getRootString())) *this = b;
-        else {
+        else if(!b.hasRoot() && !b.hasRootDirectory() && hasFilename()) {
+            
+            data += SEPARATOR;
+            data += b.getString();
+            filenameLength = b.filenameLength;
+            
+        } else {
             
             if(b.hasRootDirectory()) data.setLength(rootLength), data += b.getString();
-            else if(hasFilename() || (!hasRootDirectory() && isAbsolute())) data += SEPARATOR + b.getString();
+            else if(hasFilename() || (!hasRootDirectory() && isAbsolute())) data += SEPARATOR, data += b.getString();
             else data += b.getString();
             init();
             
@@ -182,7 +195,20 @@ public:
     StringViewType getFilenameString() const noexcept { return data.slice(data.getLength() - filenameLength); }
     FilePath getFilename() const noexcept { return getFilenameString(); }
     
-    void clear() noexcept { data.clear(); }
+    FilePath normalize() const;
+    FilePath lexicallyRelative(const FilePath& base) const;
+    FilePath lexicallyProximate(const FilePath& base) const;
+    
+    FilePath& replaceFilename(StringViewType name) {
+        
+        data.setLength(data.getLength() - filenameLength);
+        data += name;
+        filenameLength = name.getLength();
+        return *this;
+        
+    }
+    
+    void clear() noexcept { data.clear(); rootLength = 0; rootDirectoryLength = 0; filenameLength = 0; }
     
     void swap(FilePath& path) noexcept { std::swap(data, path.data); }
     
@@ -190,6 +216,7 @@ public:
     
     static FilePath getCurrent() {
         
+#if defined(CORECAT_OS_WINDOWS)
         DWORD size = ::GetCurrentDirectoryW(0, nullptr);
         if(!size) throw Corecat::SystemException("::GetCurrentDirectoryW failed");
         Corecat::WString data;
@@ -197,6 +224,18 @@ public:
         if(!::GetCurrentDirectoryW(size, data.getData()))
             throw Corecat::SystemException("::GetCurrentDirectoryW failed");
         return data;
+#elif defined(CORECAT_OS_LINUX) || defined(CORECAT_OS_MACOS)
+        StringType data;
+        data.setLength(256);
+        while(!::getcwd(data.getData(), data.getLength())) {
+            
+            if(errno != ERANGE) throw Corecat::SystemException("::getcwd failed");
+            data.setLength(data.getLength() * 2);
+            
+        }
+        data.setLength(std::strlen(data.getData()));
+        return data;
+#endif
         
     }
     
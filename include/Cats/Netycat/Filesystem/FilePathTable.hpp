@@ -0,0 +1,177 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_FILEPATHTABLE_HPP
+#define CATS_NETYCAT_FILESYSTEM_FILEPATHTABLE_HPP
+
+
+#include <cstddef>
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Cats/Corecat/Util/Operator.hpp"
+
+#include "FilePath.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+class FilePathTable;
+
+class InternedFilePath : public Corecat::EqualityOperator<InternedFilePath> {
+    
+private:
+    
+    friend FilePathTable;
+    
+public:
+    
+    using CharType = FilePath::CharType;
+    using StringViewType = FilePath::StringViewType;
+    
+private:
+    
+    struct Node {
+        
+        const Node* parent;
+        const CharType* name;
+        std::size_t nameLength;
+        std::size_t length;
+        std::size_t depth;
+        
+    };
+    
+private:
+    
+    const Node* node = nullptr;
+    
+private:
+    
+    InternedFilePath(const Node* node_) noexcept : node(node_) {}
+    
+public:
+    
+    InternedFilePath() = default;
+    
+    friend bool operator ==(const InternedFilePath& a, const InternedFilePath& b) noexcept { return a.node == b.node; }
+    
+    bool isEmpty() const noexcept { return !node; }
+    
+    InternedFilePath getParent() const noexcept { return node ? node->parent : nullptr; }
+    StringViewType getName() const noexcept { return node ? StringViewType(node->name, node->nameLength) : StringViewType(); }
+    std::size_t getLength() const noexcept { return node ? node->length : 0; }
+    std::size_t getDepth() const noexcept { return node ? node->depth : 0; }
+    bool isPrefixOf(InternedFilePath path) const noexcept {
+        
+        if(!node) return true;
+        auto p = path.node;
+        while(p && p->depth > node->depth) p = p->parent;
+        return p == node;
+        
+    }
+    
+    FilePath getPath() const;
+    void getPath(FilePath::StringType& str) const;
+    
+};
+
+class FilePathTable {
+    
+private:
+    
+    using CharType = FilePath::CharType;
+    using StringViewType = FilePath::StringViewType;
+    using Node = InternedFilePath::Node;
+    
+    struct Key {
+        
+        const Node* parent;
+        StringViewType name;
+        
+        friend bool operator ==(const Key& a, const Key& b) noexcept { return a.parent == b.parent && a.name == b.name; }
+        
+    };
+    
+    struct KeyHash {
+        
+        std::size_t operator ()(const Key& key) const noexcept {
+            
+            std::size_t h = std::hash<const void*>()(key.parent) ^ std::size_t(0xcbf29ce484222325);
+            for(auto c : key.name) h = (h ^ std::size_t(c)) * std::size_t(0x100000001b3);
+            return h;
+            
+        }
+        
+    };
+    
+public:
+    
+    static constexpr std::size_t BLOCK_SIZE = 65536;
+    
+private:
+    
+    mutable std::mutex mutex;
+    std::deque<Node> nodes;
+    std::unordered_map<Key, const Node*, KeyHash> map;
+    std::vector<std::unique_ptr<CharType[]>> blocks;
+    CharType* blockData = nullptr;
+    std::size_t blockSize = 0;
+    
+private:
+    
+    const CharType* store(StringViewType name);
+    const Node* insert(const Node* parent, StringViewType name);
+    
+public:
+    
+    FilePathTable() = default;
+    FilePathTable(const FilePathTable& src) = delete;
+    
+    FilePathTable& operator =(const FilePathTable& src) = delete;
+    
+    InternedFilePath intern(InternedFilePath parent, StringViewType name);
+    InternedFilePath intern(const FilePath& path);
+    InternedFilePath find(InternedFilePath parent, StringViewType name) const;
+    
+    std::size_t getSize() const;
+    
+    void clear();
+    
+};
+
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_IMPL_SEPARATOR_HPP
+#define CATS_NETYCAT_FILESYSTEM_IMPL_SEPARATOR_HPP
+
+
+#include <cstdint>
+
+#include "Cats/Corecat/System/OS.hpp"
+
+#include "../../Impl/SIMD.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+namespace Impl {
+
+constexpr bool isSeparator(char c) noexcept { return c == '/'; }
+constexpr bool isSeparator(wchar_t c) noexcept { return c == L'/' || c == L'\\'; }
+
+template <typename C>
+const C* findSeparatorScalar(const C* b, const C* e) noexcept {
+    
+    while(b != e && !isSeparator(*b)) ++b;
+    return b;
+    
+}
+template <typename C>
+const C* findLastSeparatorScalar(const C* b, const C* e) noexcept {
+    
+    while(e != b) if(isSeparator(*--e)) return e;
+    return nullptr;
+    
+}
+
+#if defined(NETYCAT_SIMD_AVX2)
+inline std::uint32_t matchSeparator(const char* p) noexcept {
+    
+    auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    return std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('/'))));
+    
+}
+inline std::uint32_t matchSeparator(const wchar_t* p) noexcept {
+    
+    auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    auto m = _mm256_or_si256(_mm256_cmpeq_epi16(x, _mm256_set1_epi16('/')), _mm256_cmpeq_epi16(x, _mm256_set1_epi16('\\')));
+    return std::uint32_t(_mm256_movemask_epi8(m));
+    
+}
+constexpr std::size_t SEPARATOR_BLOCK_SIZE = 32;
+#elif defined(NETYCAT_SIMD_SSE2)
+inline std::uint32_t matchSeparator(const char* p) noexcept {
+    
+    auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('/'))));
+    
+}
+inline std::uint32_t matchSeparator(const wchar_t* p) noexcept {
+    
+    auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto m = _mm_or_si128(_mm_cmpeq_epi16(x, _mm_set1_epi16('/')), _mm_cmpeq_epi16(x, _mm_set1_epi16('\\')));
+    return std::uint32_t(_mm_movemask_epi8(m));
+    
+}
+constexpr std::size_t SEPARATOR_BLOCK_SIZE = 16;
+#endif
+
+template <typename C>
+const C* findSeparator(const C* b, const C* e) noexcept {
+#if defined(NETYCAT_SIMD_AVX2) || defined(NETYCAT_SIMD_SSE2)
+    constexpr std::size_t N = SEPARATOR_BLOCK_SIZE / sizeof(C);
+    if(sizeof(C) <= 2) {
+        
+        for(; std::size_t(e - b) >= N; b += N)
+            if(auto m = matchSeparator(b)) return b + SIMD::countTrailingZero(m) / sizeof(C);
+        
+    }
+#endif
+    return findSeparatorScalar(b, e);
+}
+template <typename C>
+const C* findLastSeparator(const C* b, const C* e) noexcept {
+#if defined(NETYCAT_SIMD_AVX2) || defined(NETYCAT_SIMD_SSE2)
+    constexpr std::size_t N = SEPARATOR_BLOCK_SIZE / sizeof(C);
+    if(sizeof(C) <= 2) {
+        
+        for(; std::size_t(e - b) >= N; e -= N)
+            if(auto m = matchSeparator(e - N)) return e - N + SIMD::findHighestBit(m) / sizeof(C);
+        
+    }
+#endif
+    return findLastSeparatorScalar(b, e);
+}
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_IMPL_STATUS_HPP
+#define CATS_NETYCAT_FILESYSTEM_IMPL_STATUS_HPP
+
+
+#include <cerrno>
+#include <cstdint>
+
+#include <atomic>
+
+#include "Cats/Corecat/System/OS.hpp"
+
+#include "../FileInfo.hpp"
+
+#if defined(CORECAT_OS_LINUX)
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#endif
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+namespace Impl {
+
+#if defined(CORECAT_OS_LINUX)
+inline FileType getFileType(mode_t mode) noexcept {
+    
+    if(S_ISREG(mode)) return FileType::FILE;
+    if(S_ISDIR(mode)) return FileType::DIRECTORY;
+    if(S_ISLNK(mode)) return FileType::SYMLINK;
+    return FileType::OTHER;
+    
+}
+
+inline bool getStatus(int fd, const char* path, FileStatus& status, bool followSymlink = false) noexcept {
+    
+    int flags = (followSymlink ? 0 : AT_SYMLINK_NOFOLLOW) | AT_NO_AUTOMOUNT;
+#if defined(STATX_TYPE)
+    static std::atomic<bool> statxUnavailable{};
+    if(!statxUnavailable.load(std::memory_order_relaxed)) {
+        
+        struct statx stx;
+        if(!::statx(fd, path, flags | AT_STATX_DONT_SYNC,
+            STATX_TYPE | STATX_SIZE | STATX_MTIME | STATX_INO, &stx)) {
+            
+            status = {getFileType(stx.stx_mode), stx.stx_size, std::int64_t(stx.stx_mtime.tv_sec) * 1000000000 + stx.stx_mtime.tv_nsec, stx.stx_ino};
+            return true;
+            
+        }
+        if(errno != ENOSYS && errno != EPERM) return false;
+        statxUnavailable.store(true, std::memory_order_relaxed);
+        
+    }
+#endif
+    struct stat st;
+    if(::fstatat(fd, path, &st, flags)) return false;
+    status = {getFileType(st.st_mode), std::uint64_t(st.st_size), std::int64_t(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec, st.st_ino};
+    return true;
+    
+}
+#endif
+
+}
+}
+}
+}
+
+
+#endif
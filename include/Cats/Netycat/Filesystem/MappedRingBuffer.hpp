@@ -0,0 +1,160 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_FILESYSTEM_MAPPEDRINGBUFFER_HPP
+#define CATS_NETYCAT_FILESYSTEM_MAPPEDRINGBUFFER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "Cats/Corecat/Concurrent/Promise.hpp"
+#include "Cats/Corecat/Text/String.hpp"
+#include "Cats/Corecat/Util/Byte.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+#include "Cats/Corecat/Win32/Handle.hpp"
+
+#include "MappedFile.hpp"
+#include "../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+class MappedRingBuffer {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using String8 = Corecat::String8;
+    using Handle = Corecat::Handle;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+public:
+    
+    enum class Mode : std::uint32_t {
+        
+        SINGLE_PRODUCER,
+        MULTI_PRODUCER,
+        
+    };
+    
+    using WaitCallback = std::function<void(const ExceptionPtr&)>;
+    
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t RECORD_HEADER_SIZE = 8;
+    
+private:
+    
+    static constexpr std::uint32_t MAGIC = 0x3042524E;
+    static constexpr std::uint32_t INITIALIZING = 1;
+    static constexpr std::uint32_t COMMITTED = 0x80000000;
+    static constexpr std::uint32_t PADDING = 0x40000000;
+    static constexpr std::uint32_t SIZE_MASK = 0x3FFFFFFF;
+    
+    struct Header {
+        
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint32_t> magic;
+        std::uint32_t mode;
+        std::uint64_t capacity;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> head;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> tail;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint32_t> waiting;
+        
+    };
+    
+private:
+    
+    Header* header;
+    Byte* data;
+    std::uint64_t capacity;
+    std::uint64_t mask;
+    std::atomic<std::uint64_t> cachedHead{};
+    Mode mode;
+    Handle event;
+    Handle cancelEvent;
+    std::atomic<bool> closed{};
+    std::size_t waitCount = 0;
+    std::mutex waitMutex;
+    std::condition_variable waitCondition;
+    
+private:
+    
+    std::atomic<std::uint32_t>& getRecordHeader(std::uint64_t offset) const noexcept {
+        
+        return *reinterpret_cast<std::atomic<std::uint32_t>*>(data + offset);
+        
+    }
+    void release(std::uint64_t position, std::uint64_t size) noexcept;
+    void notify() noexcept;
+    
+public:
+    
+    MappedRingBuffer(MappedFile& file, const String8& name, Mode mode_);
+    MappedRingBuffer(const MappedRingBuffer& src) = delete;
+    ~MappedRingBuffer();
+    
+    MappedRingBuffer& operator =(const MappedRingBuffer& src) = delete;
+    
+    void close() noexcept;
+    
+    std::uint64_t getCapacity() const noexcept { return capacity; }
+    std::size_t getMaxFrameSize() const noexcept {
+        
+        return std::size_t(std::min(std::uint64_t(SIZE_MASK), capacity / 2 - RECORD_HEADER_SIZE));
+        
+    }
+    Mode getMode() const noexcept { return mode; }
+    
+    bool isEmpty() const noexcept;
+    
+    bool tryWrite(const void* buffer, std::size_t count);
+    const Byte* peek(std::size_t& count) noexcept;
+    void pop() noexcept;
+    
+    void wait(IOExecutor& executor, WaitCallback cb);
+    Promise<> waitAsync(IOExecutor& executor);
+    
+public:
+    
+    static std::uint64_t getRequiredSize(std::uint64_t capacity) noexcept { return sizeof(Header) + capacity; }
+    
+};
+
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_IOBUFFER_HPP
+#define CATS_NETYCAT_IOBUFFER_HPP
+
+
+#include <cstddef>
+
+#include <atomic>
+#include <vector>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+
+class IOBufferPool;
+
+class IOBuffer {
+    
+private:
+    
+    friend class IOBufferPool;
+    
+    using Byte = Corecat::Byte;
+    
+public:
+    
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 16384 - 64;
+    
+private:
+    
+    struct Block {
+        
+        std::atomic<std::size_t> refCount;
+        std::size_t capacity;
+        std::size_t sizeClass;
+        void* pool;
+        
+        Byte* getData() noexcept { return reinterpret_cast<Byte*>(this + 1); }
+        
+    };
+    
+    struct Segment {
+        
+        Block* block;
+        std::size_t begin;
+        std::size_t end;
+        
+    };
+    
+private:
+    
+    std::vector<Segment> segments;
+    std::size_t size = 0;
+    
+private:
+    
+    static Block* createBlock(std::size_t capacity);
+    static void retainBlock(Block* block) noexcept { ++block->refCount; }
+    static void releaseBlock(Block* block) noexcept;
+    
+    IOBuffer(Block* block);
+    
+public:
+    
+    IOBuffer() = default;
+    IOBuffer(std::size_t capacity, std::size_t headroom = 0);
+    IOBuffer(const void* data, std::size_t count, std::size_t headroom = 0, std::size_t tailroom = 0);
+    IOBuffer(const IOBuffer& src) = delete;
+    IOBuffer(IOBuffer&& src) noexcept;
+    ~IOBuffer();
+    
+    IOBuffer& operator =(const IOBuffer& src) = delete;
+    IOBuffer& operator =(IOBuffer&& src) noexcept;
+    
+    std::size_t getSize() const noexcept { return size; }
+    bool isEmpty() const noexcept { return !size; }
+    
+    std::size_t getSegmentCount() const noexcept { return segments.size(); }
+    const Byte* getSegmentData(std::size_t index) const noexcept { return segments[index].block->getData() + segments[index].begin; }
+    Byte* getSegmentData(std::size_t index) noexcept { return segments[index].block->getData() + segments[index].begin; }
+    std::size_t getSegmentSize(std::size_t index) const noexcept { return segments[index].end - segments[index].begin; }
+    
+    std::size_t getHeadroom() const noexcept;
+    std::size_t getTailroom() const noexcept;
+    
+    Byte* prepend(std::size_t count);
+    Byte* reserve(std::size_t count);
+    void commit(std::size_t count) noexcept;
+    void append(const void* data, std::size_t count);
+    void append(IOBuffer&& buffer);
+    
+    IOBuffer split(std::size_t count);
+    void trimFront(std::size_t count) noexcept;
+    void trimBack(std::size_t count) noexcept;
+    IOBuffer clone() const;
+    void clear() noexcept;
+    
+    std::size_t copyTo(void* buffer, std::size_t count, std::size_t offset = 0) const noexcept;
+    
+};
+
+}
+}
+
+
+#endif
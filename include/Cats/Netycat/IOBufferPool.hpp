@@ -0,0 +1,97 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_IOBUFFERPOOL_HPP
+#define CATS_NETYCAT_IOBUFFERPOOL_HPP
+
+
+#include <cstddef>
+
+#include <mutex>
+#include <vector>
+
+#include "IOBuffer.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+
+class IOBufferPool {
+    
+private:
+    
+    friend class IOBuffer;
+    
+    using Block = IOBuffer::Block;
+    
+public:
+    
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 65536;
+    static constexpr std::size_t SLAB_BUFFER_COUNT = 16;
+    
+private:
+    
+    struct State {
+        
+        std::mutex mutex;
+        std::size_t bufferSize;
+        std::size_t refCount = 1;
+        std::size_t bufferCount = 0;
+        std::vector<Block*> freeList;
+        std::vector<void*> slabList;
+        
+    };
+    
+private:
+    
+    State* state;
+    
+private:
+    
+    static void releaseState(State* state, std::unique_lock<std::mutex>& lock) noexcept;
+    static void releaseBlock(Block* block) noexcept;
+    
+public:
+    
+    IOBufferPool(std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    IOBufferPool(const IOBufferPool& src) = delete;
+    ~IOBufferPool();
+    
+    IOBufferPool& operator =(const IOBufferPool& src) = delete;
+    
+    IOBuffer acquire();
+    
+    std::size_t getBufferSize() const noexcept { return state->bufferSize; }
+    std::size_t getBufferCount() const noexcept;
+    std::size_t getFreeCount() const noexcept;
+    
+};
+
+}
+}
+
+
+#endif
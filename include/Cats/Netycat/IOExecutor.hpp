@@ -40,6 +40,8 @@
 #include "Cats/Corecat/Time/HighResolutionClock.hpp"
 #include "Cats/Corecat/Util/ExceptionPtr.hpp"
 
+#include "IOBufferPool.hpp"
+
 #if defined(CORECAT_OS_WINDOWS)
 #   include "Cats/Corecat/Win32/Handle.hpp"
 #   define NETYCAT_IOEXECUTOR_IOCP
@@ -47,10 +49,18 @@
 #   error Unknown OS
 #endif
 
+#if defined(__cpp_impl_coroutine)
+#   define NETYCAT_AWAITABLE
+#endif
+
 
 namespace Cats {
 namespace Netycat {
 
+#if defined(NETYCAT_AWAITABLE)
+class SleepAwaitable;
+#endif
+
 class IOExecutor {
     
 private:
@@ -63,18 +73,43 @@ private:
 #if defined(NETYCAT_IOEXECUTOR_IOCP)
 public:
     
+    struct Operation : public OVERLAPPED {
+        
+        using CompleteFunction = void (*)(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count);
+        
+        CompleteFunction complete;
+        
+        Operation(CompleteFunction complete_) noexcept : OVERLAPPED(), complete(complete_) {}
+        Operation(const Operation& src) = delete;
+        
+        Operation& operator =(const Operation& src) = delete;
+        
+    };
+    
     using OverlappedCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
-    struct Overlapped : public OVERLAPPED {
+    struct Overlapped : public Operation {
         
         OverlappedCallback cb;
         
-        Overlapped(OverlappedCallback cb_) : OVERLAPPED(), cb(std::move(cb_)) {}
+        Overlapped(OverlappedCallback cb_) : Operation(&completeOverlapped), cb(std::move(cb_)) {}
         Overlapped(const Overlapped& src) = delete;
         
         Overlapped& operator =(const Overlapped& src) = delete;
         
     };
     
+    using PersistentOverlappedCallback = std::function<bool(const ExceptionPtr&, std::size_t)>;
+    struct PersistentOverlapped : public Operation {
+        
+        PersistentOverlappedCallback cb;
+        
+        PersistentOverlapped(PersistentOverlappedCallback cb_) : Operation(&completePersistentOverlapped), cb(std::move(cb_)) {}
+        PersistentOverlapped(const PersistentOverlapped& src) = delete;
+        
+        PersistentOverlapped& operator =(const PersistentOverlapped& src) = delete;
+        
+    };
+    
 private:
     
     Corecat::Handle completionPort;
@@ -91,8 +126,14 @@ private:
         
         Corecat::HighResolutionClock::time_point timePoint;
         WaitCallback cb;
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+        Operation* operation = nullptr;
+#endif
         
         Timer(Corecat::HighResolutionClock::time_point timePoint_, WaitCallback cb_) : timePoint(timePoint_), cb(std::move(cb_)) {}
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+        Timer(Corecat::HighResolutionClock::time_point timePoint_, Operation* operation_) : timePoint(timePoint_), operation(operation_) {}
+#endif
         
         friend bool operator <(const Timer& a, const Timer& b) { return a.timePoint > b.timePoint; }
         
@@ -100,6 +141,7 @@ private:
     std::priority_queue<Timer> timerQueue;
     
     ThreadPoolExecutor threadPool;
+    IOBufferPool bufferPool;
     
 public:
     
@@ -115,15 +157,29 @@ public:
     
     void wait(double time, WaitCallback cb);
     Promise<> waitAsync(double time);
+#if defined(NETYCAT_AWAITABLE)
+    SleepAwaitable sleep(double time) noexcept;
+#endif
     
     ThreadPoolExecutor& getThreadPool() noexcept { return threadPool; }
+    IOBufferPool& getBufferPool() noexcept { return bufferPool; }
     
     void run();
     
 #if defined(NETYCAT_IOEXECUTOR_IOCP)
     void attachHandle(HANDLE handle);
+    void wait(double time, Operation* operation);
     Overlapped* createOverlapped(OverlappedCallback cb);
+    PersistentOverlapped* createPersistentOverlapped(PersistentOverlappedCallback cb);
+    void resetOverlapped(PersistentOverlapped* overlapped);
+    void post(Operation* operation);
     void destroyOverlapped(Overlapped* overlapped);
+    void destroyOverlapped(PersistentOverlapped* overlapped);
+    
+private:
+    
+    static void completeOverlapped(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count);
+    static void completePersistentOverlapped(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count);
 #endif
     
 };
@@ -132,4 +188,9 @@ public:
 }
 
 
+#if defined(NETYCAT_AWAITABLE)
+#   include "Awaitable.hpp"
+#endif
+
+
 #endif
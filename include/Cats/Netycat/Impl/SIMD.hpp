@@ -0,0 +1,89 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_IMPL_SIMD_HPP
+#define CATS_NETYCAT_IMPL_SIMD_HPP
+
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+#   define NETYCAT_SIMD_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define NETYCAT_SIMD_SSE2
+#endif
+
+#if defined(NETYCAT_SIMD_AVX2)
+#   include <immintrin.h>
+#elif defined(NETYCAT_SIMD_SSE2)
+#   include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
+
+namespace Cats {
+namespace Netycat {
+namespace SIMD {
+
+inline unsigned countTrailingZero(std::uint32_t x) noexcept {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return unsigned(i);
+#else
+    return unsigned(__builtin_ctz(x));
+#endif
+}
+
+inline unsigned findHighestBit(std::uint32_t x) noexcept {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanReverse(&i, x);
+    return unsigned(i);
+#else
+    return 31 - unsigned(__builtin_clz(x));
+#endif
+}
+
+inline unsigned countPopulation(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return unsigned(__popcnt64(x));
+#elif defined(_MSC_VER)
+    return unsigned(__popcnt(std::uint32_t(x)) + __popcnt(std::uint32_t(x >> 32)));
+#else
+    return unsigned(__builtin_popcountll(x));
+#endif
+}
+
+}
+}
+}
+
+
+#endif
@@ -28,6 +28,7 @@
 #define CATS_NETYCAT_NETWORK_HPP
 
 
+#include "Network/HTTP.hpp"
 #include "Network/IP.hpp"
 #include "Network/TCP.hpp"
 #include "Network/UDP.hpp"
@@ -0,0 +1,130 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPCLIENT_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPCLIENT_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "Cats/Corecat/Concurrent/Promise.hpp"
+#include "Cats/Corecat/Text/String.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+
+#include "HTTPRequest.hpp"
+#include "HTTPResponse.hpp"
+#include "../IP/IPResolver.hpp"
+#include "../TCP/TCPEndpoint.hpp"
+#include "../../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPClient {
+    
+private:
+    
+    using String8 = Corecat::String8;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+    class Connection;
+    struct Host;
+    struct Pending;
+    
+public:
+    
+    using EndpointType = TCPEndpoint;
+    
+    using RequestCallback = std::function<void(const ExceptionPtr&, HTTPResponse&)>;
+    
+    static constexpr std::size_t DEFAULT_MAX_CONNECTION_COUNT = 8;
+    static constexpr std::size_t DEFAULT_PIPELINE_DEPTH = 1;
+    static constexpr double DEFAULT_IDLE_TIMEOUT = 30.0;
+    
+private:
+    
+    IOExecutor& executor;
+    IPResolver resolver;
+    std::size_t maxConnectionCount = DEFAULT_MAX_CONNECTION_COUNT;
+    std::size_t pipelineDepth = DEFAULT_PIPELINE_DEPTH;
+    double idleTimeout = DEFAULT_IDLE_TIMEOUT;
+    std::unordered_map<EndpointType, std::unique_ptr<Host>> hostMap;
+    std::shared_ptr<bool> alive;
+    bool sweeping = false;
+    
+private:
+    
+    void dispatch(Host& host);
+    void open(Host& host);
+    void remove(Connection* connection) noexcept;
+    void scheduleSweep();
+    void sweep();
+    
+public:
+    
+    HTTPClient(IOExecutor& executor_);
+    HTTPClient(const HTTPClient& src) = delete;
+    ~HTTPClient();
+    
+    HTTPClient& operator =(const HTTPClient& src) = delete;
+    
+    void request(const EndpointType& endpoint, HTTPRequest request, RequestCallback cb);
+    void request(const String8& host, std::uint16_t port, HTTPRequest request, RequestCallback cb);
+    Promise<HTTPResponse> requestAsync(const EndpointType& endpoint, HTTPRequest request);
+    Promise<HTTPResponse> requestAsync(const String8& host, std::uint16_t port, HTTPRequest request);
+    
+    void close() noexcept;
+    
+    std::size_t getMaxConnectionCount() const noexcept { return maxConnectionCount; }
+    void setMaxConnectionCount(std::size_t maxConnectionCount_) noexcept { maxConnectionCount = maxConnectionCount_ ? maxConnectionCount_ : 1; }
+    std::size_t getPipelineDepth() const noexcept { return pipelineDepth; }
+    void setPipelineDepth(std::size_t pipelineDepth_) noexcept { pipelineDepth = pipelineDepth_ ? pipelineDepth_ : 1; }
+    double getIdleTimeout() const noexcept { return idleTimeout; }
+    void setIdleTimeout(double idleTimeout_) noexcept { idleTimeout = idleTimeout_; }
+    
+    std::size_t getConnectionCount() const noexcept;
+    std::size_t getIdleConnectionCount() const noexcept;
+    IOExecutor& getExecutor() noexcept { return executor; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPMESSAGE_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPMESSAGE_HPP
+
+
+#include <cstddef>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPMessage {
+    
+public:
+    
+    using HeaderList = std::vector<std::pair<std::string, std::string>>;
+    
+protected:
+    
+    unsigned version = 11;
+    HeaderList headers;
+    std::string body;
+    
+public:
+    
+    unsigned getVersion() const noexcept { return version; }
+    void setVersion(unsigned version_) noexcept { version = version_; }
+    
+    const HeaderList& getHeaders() const noexcept { return headers; }
+    const std::string* getHeader(const char* name) const noexcept;
+    bool hasHeaderToken(const char* name, const char* token) const noexcept;
+    void setHeader(const char* name, std::string value);
+    void addHeader(std::string name, std::string value);
+    void removeHeader(const char* name) noexcept;
+    void clearHeaders() noexcept { headers.clear(); }
+    
+    const std::string& getBody() const noexcept { return body; }
+    std::string& getBody() noexcept { return body; }
+    void setBody(std::string body_) noexcept { body = std::move(body_); }
+    
+    bool isKeepAlive() const noexcept;
+    bool isChunked() const noexcept { return hasHeaderToken("Transfer-Encoding", "chunked"); }
+    
+    void clear() noexcept;
+    
+public:
+    
+    static bool equalsIgnoreCase(const char* a, std::size_t aLength, const char* b, std::size_t bLength) noexcept;
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPPARSER_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPPARSER_HPP
+
+
+#include <cstddef>
+
+#include <string>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+
+#include "HTTPRequest.hpp"
+#include "HTTPResponse.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPParser {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+public:
+    
+    static constexpr std::size_t DEFAULT_MAX_HEADER_SIZE = 65536;
+    static constexpr std::size_t DEFAULT_MAX_BODY_SIZE = 16777216;
+    
+private:
+    
+    std::size_t maxHeaderSize;
+    std::size_t maxBodySize;
+    std::size_t scanned = 0;
+    std::size_t chunkOffset = 0;
+    std::string chunkBody;
+    bool chunkTrailer = false;
+    bool headerTooLarge = false;
+    
+private:
+    
+    std::size_t findHeaderEnd(const Byte* data, std::size_t size, ExceptionPtr& e) noexcept;
+    void parseHeaderList(const Byte* begin, const Byte* end, HTTPMessage& message, ExceptionPtr& e) const;
+    std::size_t parseBody(const Byte* data, std::size_t size, std::size_t headerSize, HTTPMessage& message, bool untilClose, bool closed, ExceptionPtr& e);
+    std::size_t parseChunked(const Byte* data, std::size_t size, ExceptionPtr& e);
+    
+public:
+    
+    HTTPParser(std::size_t maxHeaderSize_ = DEFAULT_MAX_HEADER_SIZE, std::size_t maxBodySize_ = DEFAULT_MAX_BODY_SIZE) noexcept :
+        maxHeaderSize(maxHeaderSize_), maxBodySize(maxBodySize_) {}
+    
+    std::size_t parseRequest(const Byte* data, std::size_t size, HTTPRequest& request, ExceptionPtr& e);
+    std::size_t parseResponse(const Byte* data, std::size_t size, HTTPResponse& response, bool head, bool closed, ExceptionPtr& e);
+    
+    bool isHeaderTooLarge() const noexcept { return headerTooLarge; }
+    
+    void reset() noexcept {
+        
+        scanned = 0;
+        chunkOffset = 0;
+        chunkBody.clear();
+        chunkTrailer = false;
+        headerTooLarge = false;
+        
+    }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPREQUEST_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPREQUEST_HPP
+
+
+#include <string>
+
+#include "HTTPMessage.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPRequest : public HTTPMessage {
+    
+private:
+    
+    std::string method = "GET";
+    std::string target = "/";
+    
+public:
+    
+    HTTPRequest() = default;
+    HTTPRequest(std::string method_, std::string target_) : method(std::move(method_)), target(std::move(target_)) {}
+    
+    const std::string& getMethod() const noexcept { return method; }
+    void setMethod(std::string method_) noexcept { method = std::move(method_); }
+    const std::string& getTarget() const noexcept { return target; }
+    void setTarget(std::string target_) noexcept { target = std::move(target_); }
+    
+    bool isHead() const noexcept { return method == "HEAD"; }
+    
+    void serializeHeader(std::string& out) const;
+    
+    void clear() noexcept;
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPRESPONSE_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPRESPONSE_HPP
+
+
+#include <cstdint>
+
+#include <memory>
+#include <string>
+
+#include "HTTPMessage.hpp"
+#include "../../Filesystem/File.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPResponse : public HTTPMessage {
+    
+private:
+    
+    int status = 200;
+    std::string reason;
+    std::shared_ptr<File> file;
+    std::uint64_t fileSize = 0;
+    
+public:
+    
+    HTTPResponse() = default;
+    HTTPResponse(int status_) : status(status_) {}
+    
+    int getStatus() const noexcept { return status; }
+    void setStatus(int status_) noexcept { status = status_; }
+    const char* getReason() const noexcept { return reason.empty() ? getDefaultReason(status) : reason.c_str(); }
+    void setReason(std::string reason_) noexcept { reason = std::move(reason_); }
+    
+    File* getFile() const noexcept { return file.get(); }
+    std::uint64_t getFileSize() const noexcept { return fileSize; }
+    void setFile(const FilePath& path);
+    
+    bool hasBody() const noexcept { return status >= 200 && status != 204 && status != 304; }
+    
+    void serializeHeader(std::string& out) const;
+    
+    void clear() noexcept;
+    
+public:
+    
+    static const char* getDefaultReason(int status) noexcept;
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_HTTP_HTTPSERVER_HPP
+#define CATS_NETYCAT_NETWORK_HTTP_HTTPSERVER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+
+#include "HTTPParser.hpp"
+#include "HTTPRequest.hpp"
+#include "HTTPResponse.hpp"
+#include "../IP/IPAddress.hpp"
+#include "../TCP/TCPEndpoint.hpp"
+#include "../TCP/TCPServer.hpp"
+#include "../../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+class HTTPServer {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+    class Connection;
+    
+public:
+    
+    using EndpointType = TCPEndpoint;
+    
+    using Handler = std::function<void(const HTTPRequest&, HTTPResponse&)>;
+    
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 16384;
+    
+private:
+    
+    IOExecutor& executor;
+    Handler handler;
+    TCPServer server;
+    std::size_t maxHeaderSize = HTTPParser::DEFAULT_MAX_HEADER_SIZE;
+    std::size_t maxBodySize = HTTPParser::DEFAULT_MAX_BODY_SIZE;
+    std::unordered_map<Connection*, std::unique_ptr<Connection>> connectionMap;
+    bool running = false;
+    
+private:
+    
+    void start();
+    void remove(Connection* connection) noexcept;
+    
+public:
+    
+    HTTPServer(IOExecutor& executor_, Handler handler_);
+    HTTPServer(const HTTPServer& src) = delete;
+    ~HTTPServer();
+    
+    HTTPServer& operator =(const HTTPServer& src) = delete;
+    
+    void listen(std::uint16_t port);
+    void listen(const IPAddress& address, std::uint16_t port);
+    void listen(const EndpointType& endpoint);
+    void listen(std::uint16_t port, ExceptionPtr& e) noexcept;
+    void listen(const IPAddress& address, std::uint16_t port, ExceptionPtr& e) noexcept;
+    void listen(const EndpointType& endpoint, ExceptionPtr& e) noexcept;
+    
+    void close() noexcept;
+    
+    void setMaxHeaderSize(std::size_t maxHeaderSize_) noexcept { maxHeaderSize = maxHeaderSize_; }
+    void setMaxBodySize(std::size_t maxBodySize_) noexcept { maxBodySize = maxBodySize_; }
+    
+    std::size_t getConnectionCount() const noexcept { return connectionMap.size(); }
+    bool isRunning() const noexcept { return running; }
+    IOExecutor& getExecutor() noexcept { return executor; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -29,6 +29,9 @@
 
 
 #include "IP/IPAddress.hpp"
+#include "IP/IPHashMap.hpp"
+#include "IP/IPNetwork.hpp"
+#include "IP/IPNetworkTable.hpp"
 #include "IP/IPResolver.hpp"
 
 
@@ -28,13 +28,19 @@
 #define CATS_NETYCAT_NETWORK_IP_IPADDRESS_HPP
 
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
-#include "Cats/Corecat/Text/Formatter.hpp"
+#include <functional>
+#include <vector>
+
+#include "Cats/Corecat/Text/String.hpp"
 #include "Cats/Corecat/Util/Exception.hpp"
 #include "Cats/Corecat/Util/Operator.hpp"
 
+#include "../Impl/Hash.hpp"
+
 
 namespace Cats {
 namespace Netycat {
@@ -51,12 +57,16 @@ private:
     
     std::uint8_t data[4];
     
+public:
+    
+    static constexpr std::size_t MAX_STRING_LENGTH = 15;
+    
 public:
     
     IPv4Address() = default;
-    IPv4Address(const std::uint8_t* data_) noexcept : data{data_[0], data_[1], data_[2], data_[3]} {}
-    IPv4Address(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3) noexcept : data{d0, d1, d2, d3} {}
-    IPv4Address(std::uint32_t data_) noexcept :
+    constexpr IPv4Address(const std::uint8_t* data_) noexcept : data{data_[0], data_[1], data_[2], data_[3]} {}
+    constexpr IPv4Address(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3) noexcept : data{d0, d1, d2, d3} {}
+    constexpr IPv4Address(std::uint32_t data_) noexcept :
         data{static_cast<std::uint8_t>(data_ >> 24), static_cast<std::uint8_t>(data_ >> 16),
             static_cast<std::uint8_t>(data_ >> 8), static_cast<std::uint8_t>(data_)} {}
     IPv4Address(const IPv4Address& src) = default;
@@ -68,22 +78,35 @@ public:
     
     operator std::uint32_t() const { return data[0] << 24 | (data[1] << 16) | (data[2] << 8) | data[3]; }
     
-    const std::uint8_t* getData() const noexcept { return data; }
+    constexpr const std::uint8_t* getData() const noexcept { return data; }
     std::uint8_t* getData() noexcept { return data; }
     void setData(const std::uint8_t* data_) noexcept { std::memcpy(data, data_, 4); }
     void setData(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3) noexcept { data[0] = d0, data[1] = d1, data[2] = d2, data[3] = d3; }
     
+    std::size_t formatTo(char* str) const noexcept;
     String8 toString() const {
         
-        using namespace Corecat;
-        return "{}.{}.{}.{}"_format(data[0], data[1], data[2], data[3]);
+        char str[MAX_STRING_LENGTH];
+        return String8(str, formatTo(str));
         
     }
     
+    std::uint64_t getHash() const noexcept { return Impl::mixHash(std::uint32_t(*this)); }
+    
 public:
     
-    static IPv4Address getAny() noexcept { return {0, 0, 0, 0}; }
-    static IPv4Address getLoopback() noexcept { return {127, 0, 0, 1}; }
+    static constexpr IPv4Address getAny() noexcept { return {0, 0, 0, 0}; }
+    static constexpr IPv4Address getLoopback() noexcept { return {127, 0, 0, 1}; }
+    
+    static bool tryParse(const char* str, std::size_t length, IPv4Address& address) noexcept;
+    static IPv4Address parse(const char* str, std::size_t length) {
+        
+        IPv4Address address;
+        if(!tryParse(str, length, address)) throw Corecat::InvalidArgumentException("Invalid IPv4 address");
+        return address;
+        
+    }
+    static IPv4Address parse(const String8& str) { return parse(str.getData(), str.getLength()); }
     
 };
 
@@ -98,13 +121,17 @@ private:
     std::uint8_t data[16];
     std::uint32_t scope;
     
+public:
+    
+    static constexpr std::size_t MAX_STRING_LENGTH = 50;
+    
 public:
     
     IPv6Address() = default;
-    IPv6Address(const std::uint8_t* data_, std::uint32_t scope_ = 0) noexcept :
+    constexpr IPv6Address(const std::uint8_t* data_, std::uint32_t scope_ = 0) noexcept :
         data{data_[0], data_[1], data_[2], data_[3], data_[4], data_[5], data_[6], data_[7],
             data_[8], data_[9], data_[10], data_[11], data_[12], data_[13], data_[14], data_[15]}, scope(scope_) {}
-    IPv6Address(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3,
+    constexpr IPv6Address(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3,
         std::uint8_t d4, std::uint8_t d5, std::uint8_t d6, std::uint8_t d7,
         std::uint8_t d8, std::uint8_t d9, std::uint8_t d10, std::uint8_t d11,
         std::uint8_t d12, std::uint8_t d13, std::uint8_t d14, std::uint8_t d15, std::uint32_t scope_ = 0) noexcept :
@@ -121,7 +148,7 @@ public:
         
     }
     
-    const std::uint8_t* getData() const noexcept { return data; }
+    constexpr const std::uint8_t* getData() const noexcept { return data; }
     std::uint8_t* getData() noexcept { return data; }
     void setData(const std::uint8_t* data_) noexcept { std::memcpy(data, data_, 16); }
     void setData(std::uint8_t d0, std::uint8_t d1, std::uint8_t d2, std::uint8_t d3,
@@ -134,26 +161,40 @@ public:
         
     }
     
-    const std::uint32_t& getScope() const noexcept { return scope; }
+    constexpr const std::uint32_t& getScope() const noexcept { return scope; }
     std::uint32_t& getScope() noexcept { return scope; }
     void setScope(std::uint32_t scope_) noexcept { scope = scope_; }
     
+    std::size_t formatTo(char* str) const noexcept;
     String8 toString() const {
         
-        using namespace Corecat;
-        return "{:x}:{:x}:{:x}:{:x}:{:x}:{:x}:{:x}:{:x}%{}"_format(
-            (std::uint16_t(data[0]) << 8) | data[1], (std::uint16_t(data[2]) << 8) | data[3],
-            (std::uint16_t(data[4]) << 8) | data[5], (std::uint16_t(data[6]) << 8) | data[7],
-            (std::uint16_t(data[8]) << 8) | data[9], (std::uint16_t(data[10]) << 8) | data[11],
-            (std::uint16_t(data[12]) << 8) | data[13], (std::uint16_t(data[14]) << 8) | data[15],
-            scope);
+        char str[MAX_STRING_LENGTH];
+        return String8(str, formatTo(str));
+        
+    }
+    
+    std::uint64_t getHash() const noexcept {
+        
+        std::uint64_t x[2];
+        std::memcpy(x, data, 16);
+        return Impl::mixHash(x[0] ^ (std::uint64_t(scope) << 32), x[1] ^ scope);
         
     }
     
 public:
     
-    static IPv6Address getAny() noexcept { return {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; }
-    static IPv6Address getLoopback() noexcept { return {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}; }
+    static constexpr IPv6Address getAny() noexcept { return {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; }
+    static constexpr IPv6Address getLoopback() noexcept { return {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}; }
+    
+    static bool tryParse(const char* str, std::size_t length, IPv6Address& address) noexcept;
+    static IPv6Address parse(const char* str, std::size_t length) {
+        
+        IPv6Address address;
+        if(!tryParse(str, length, address)) throw Corecat::InvalidArgumentException("Invalid IPv6 address");
+        return address;
+        
+    }
+    static IPv6Address parse(const String8& str) { return parse(str.getData(), str.getLength()); }
     
 };
 
@@ -165,47 +206,55 @@ private:
     
 public:
     
-    enum class Type {IPv4, IPv6};
+    enum class Type : std::uint8_t {IPv4, IPv6};
+    
+    static constexpr std::size_t MAX_STRING_LENGTH = IPv6Address::MAX_STRING_LENGTH;
     
 private:
     
+    std::uint8_t data[16];
+    std::uint8_t scope[4];
     Type type;
-    union {
+    
+private:
+    
+    std::uint32_t getScope() const noexcept {
         
-        IPv4Address v4;
-        IPv6Address v6;
+        return std::uint32_t(scope[0]) << 24 | (std::uint32_t(scope[1]) << 16) | (std::uint32_t(scope[2]) << 8) | scope[3];
         
-    };
+    }
+    
+    IPv4Address toIPv4() const noexcept { return data + 12; }
+    IPv6Address toIPv6() const noexcept { return {data, getScope()}; }
     
 public:
     
     IPAddress() = default;
-    IPAddress(const IPv4Address& src) noexcept : type(Type::IPv4), v4(src) {}
-    IPAddress(const IPv6Address& src) noexcept : type(Type::IPv6), v6(src) {}
+    constexpr IPAddress(const IPv4Address& src) noexcept :
+        data{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, src.getData()[0], src.getData()[1], src.getData()[2], src.getData()[3]},
+        scope{0, 0, 0, 0}, type(Type::IPv4) {}
+    constexpr IPAddress(const IPv6Address& src) noexcept :
+        data{src.getData()[0], src.getData()[1], src.getData()[2], src.getData()[3],
+            src.getData()[4], src.getData()[5], src.getData()[6], src.getData()[7],
+            src.getData()[8], src.getData()[9], src.getData()[10], src.getData()[11],
+            src.getData()[12], src.getData()[13], src.getData()[14], src.getData()[15]},
+        scope{static_cast<std::uint8_t>(src.getScope() >> 24), static_cast<std::uint8_t>(src.getScope() >> 16),
+            static_cast<std::uint8_t>(src.getScope() >> 8), static_cast<std::uint8_t>(src.getScope())}, type(Type::IPv6) {}
     IPAddress(const IPAddress& src) = default;
     
-    IPAddress& operator =(const IPv4Address& src) noexcept { type = Type::IPv4, v4 = src; return *this; }
-    IPAddress& operator =(const IPv6Address& src) noexcept { type = Type::IPv6, v6 = src; return *this; }
+    IPAddress& operator =(const IPv4Address& src) noexcept { return *this = IPAddress(src); }
+    IPAddress& operator =(const IPv6Address& src) noexcept { return *this = IPAddress(src); }
     IPAddress& operator =(const IPAddress& src) = default;
     
     friend bool operator ==(const IPAddress& a, const IPAddress& b) noexcept {
         
-        if(a.type != b.type) return false;
-        switch(a.type) {
-        case Type::IPv4: return a.v4 == b.v4;
-        case Type::IPv6: return a.v6 == b.v6;
-        default: return false;
-        }
+        return !std::memcmp(a.data, b.data, sizeof(data) + sizeof(scope)) && a.type == b.type;
         
     }
     friend bool operator <(const IPAddress& a, const IPAddress& b) noexcept {
         
-        if(a.type != b.type) return a.type < b.type;
-        switch(a.type) {
-        case Type::IPv4: return a.v4 < b.v4;
-        case Type::IPv6: return a.v6 < b.v6;
-        default: return false;
-        }
+        int x = std::memcmp(a.data, b.data, sizeof(data) + sizeof(scope));
+        return x ? x < 0 : a.type < b.type;
         
     }
     
@@ -214,26 +263,60 @@ public:
     bool isIPv4() const noexcept { return type == Type::IPv4; }
     bool isIPv6() const noexcept { return type == Type::IPv6; }
     
-    const IPv4Address& getIPv4() const { if(type != Type::IPv4) throw Corecat::InvalidArgumentException("Address is not IPv4"); return v4; }
-    IPv4Address& getIPv4() { if(type != Type::IPv4) throw Corecat::InvalidArgumentException("Address is not IPv4"); return v4; }
-    const IPv6Address& getIPv6() const { if(type != Type::IPv6) throw Corecat::InvalidArgumentException("Address is not IPv6"); return v6; }
-    IPv6Address& getIPv6() { if(type != Type::IPv6) throw Corecat::InvalidArgumentException("Address is not IPv6"); return v6; }
+    const std::uint8_t* getData() const noexcept { return isIPv4() ? data + 12 : data; }
+    std::uint8_t* getData() noexcept { return isIPv4() ? data + 12 : data; }
     
-    String8 toString() const {
+    IPv4Address getIPv4() const { if(!isIPv4()) throw Corecat::InvalidArgumentException("Address is not IPv4"); return toIPv4(); }
+    IPv6Address getIPv6() const { if(!isIPv6()) throw Corecat::InvalidArgumentException("Address is not IPv6"); return toIPv6(); }
+    
+    std::size_t formatTo(char* str) const noexcept { return isIPv4() ? toIPv4().formatTo(str) : toIPv6().formatTo(str); }
+    String8 toString() const { return isIPv4() ? toIPv4().toString() : toIPv6().toString(); }
+    
+    std::uint64_t getHash() const noexcept { return isIPv4() ? toIPv4().getHash() : toIPv6().getHash(); }
+    
+public:
+    
+    static bool tryParse(const char* str, std::size_t length, IPAddress& address) noexcept;
+    static IPAddress parse(const char* str, std::size_t length) {
         
-        switch(type) {
-        case Type::IPv4: return v4.toString();
-        case Type::IPv6: return v6.toString();
-        default: return "<Unknown>";
-        }
+        IPAddress address;
+        if(!tryParse(str, length, address)) throw Corecat::InvalidArgumentException("Invalid IP address");
+        return address;
         
     }
+    static IPAddress parse(const String8& str) { return parse(str.getData(), str.getLength()); }
+    static std::size_t parseMany(const char* str, std::size_t length, std::vector<IPAddress>& addresses);
     
 };
 
+static_assert(alignof(IPAddress) == 1 && sizeof(IPAddress) < 24, "IPAddress must stay byte-aligned and smaller than a tagged union");
+
+}
 }
 }
 }
+
+namespace std {
+
+template <>
+struct hash<Cats::Netycat::IPv4Address> {
+    
+    std::size_t operator ()(const Cats::Netycat::IPv4Address& address) const noexcept { return std::size_t(address.getHash()); }
+    
+};
+template <>
+struct hash<Cats::Netycat::IPv6Address> {
+    
+    std::size_t operator ()(const Cats::Netycat::IPv6Address& address) const noexcept { return std::size_t(address.getHash()); }
+    
+};
+template <>
+struct hash<Cats::Netycat::IPAddress> {
+    
+    std::size_t operator ()(const Cats::Netycat::IPAddress& address) const noexcept { return std::size_t(address.getHash()); }
+    
+};
+
 }
 
 
@@ -0,0 +1,279 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IP_IPHASHMAP_HPP
+#define CATS_NETYCAT_NETWORK_IP_IPHASHMAP_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#include "Cats/Corecat/Util/Operator.hpp"
+
+#include "IPAddress.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace IP {
+
+template <typename K, typename V, typename H = std::hash<K>, typename E = std::equal_to<K>>
+class IPHashMap {
+    
+public:
+    
+    using KeyType = K;
+    using ValueType = V;
+    using EntryType = std::pair<K, V>;
+    
+    template <typename M, typename T>
+    class IteratorBase : public Corecat::EqualityOperator<IteratorBase<M, T>> {
+        
+    private:
+        
+        friend IPHashMap;
+        
+    public:
+        
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = std::forward_iterator_tag;
+        
+    private:
+        
+        M* map;
+        std::size_t index;
+        
+    private:
+        
+        IteratorBase(M* map_, std::size_t index_) noexcept : map(map_), index(index_) { skip(); }
+        
+        void skip() noexcept { while(index != map->capacity && map->controls[index] == EMPTY) ++index; }
+        
+    public:
+        
+        T& operator *() const noexcept { return map->slots[index].get(); }
+        T* operator ->() const noexcept { return &map->slots[index].get(); }
+        IteratorBase& operator ++() noexcept { ++index; skip(); return *this; }
+        IteratorBase operator ++(int) noexcept { auto it = *this; ++*this; return it; }
+        friend bool operator ==(const IteratorBase& a, const IteratorBase& b) noexcept { return a.index == b.index; }
+        
+    };
+    using Iterator = IteratorBase<IPHashMap, EntryType>;
+    using ConstIterator = IteratorBase<const IPHashMap, const EntryType>;
+    
+    static constexpr std::size_t MIN_CAPACITY = 16;
+    
+private:
+    
+    static constexpr std::uint8_t EMPTY = 0x80;
+    
+    struct Slot {
+        
+        alignas(EntryType) unsigned char data[sizeof(EntryType)];
+        
+        EntryType& get() noexcept { return *reinterpret_cast<EntryType*>(data); }
+        const EntryType& get() const noexcept { return *reinterpret_cast<const EntryType*>(data); }
+        
+    };
+    
+private:
+    
+    std::unique_ptr<std::uint8_t[]> controls;
+    std::unique_ptr<Slot[]> slots;
+    std::size_t capacity = 0;
+    std::size_t size = 0;
+    H hasher;
+    E equal;
+    
+private:
+    
+    static std::uint8_t getTag(std::size_t hash) noexcept { return std::uint8_t(hash >> (sizeof(std::size_t) * 8 - 7)); }
+    
+    std::size_t findIndex(const K& key) const noexcept {
+        
+        if(!size) return capacity;
+        auto hash = hasher(key);
+        auto tag = getTag(hash);
+        auto mask = capacity - 1;
+        for(auto i = hash & mask; controls[i] != EMPTY; i = (i + 1) & mask)
+            if(controls[i] == tag && equal(slots[i].get().first, key)) return i;
+        return capacity;
+        
+    }
+    
+    std::size_t insertIndex(std::size_t hash) noexcept {
+        
+        auto mask = capacity - 1;
+        auto i = hash & mask;
+        while(controls[i] != EMPTY) i = (i + 1) & mask;
+        controls[i] = getTag(hash);
+        ++size;
+        return i;
+        
+    }
+    
+    void rehash(std::size_t newCapacity) {
+        
+        std::unique_ptr<std::uint8_t[]> newControls(new std::uint8_t[newCapacity]);
+        std::unique_ptr<Slot[]> newSlots(new Slot[newCapacity]);
+        std::fill(newControls.get(), newControls.get() + newCapacity, std::uint8_t(EMPTY));
+        
+        auto oldControls = std::move(controls);
+        auto oldSlots = std::move(slots);
+        auto oldCapacity = capacity;
+        controls = std::move(newControls), slots = std::move(newSlots), capacity = newCapacity, size = 0;
+        for(std::size_t i = 0; i < oldCapacity; ++i) {
+            
+            if(oldControls[i] == EMPTY) continue;
+            auto& entry = oldSlots[i].get();
+            new(slots[insertIndex(hasher(entry.first))].data) EntryType(std::move(entry));
+            entry.~EntryType();
+            
+        }
+        
+    }
+    
+    void destroy() noexcept {
+        
+        for(std::size_t i = 0; i < capacity; ++i)
+            if(controls[i] != EMPTY) slots[i].get().~EntryType(), controls[i] = EMPTY;
+        size = 0;
+        
+    }
+    
+public:
+    
+    IPHashMap() = default;
+    IPHashMap(std::size_t count) { reserve(count); }
+    IPHashMap(const IPHashMap& src) = delete;
+    IPHashMap(IPHashMap&& src) noexcept :
+        controls(std::move(src.controls)), slots(std::move(src.slots)), capacity(src.capacity), size(src.size),
+        hasher(std::move(src.hasher)), equal(std::move(src.equal)) { src.capacity = 0, src.size = 0; }
+    ~IPHashMap() { destroy(); }
+    
+    IPHashMap& operator =(const IPHashMap& src) = delete;
+    IPHashMap& operator =(IPHashMap&& src) noexcept {
+        
+        destroy();
+        controls = std::move(src.controls), slots = std::move(src.slots), capacity = src.capacity, size = src.size;
+        hasher = std::move(src.hasher), equal = std::move(src.equal);
+        src.capacity = 0, src.size = 0;
+        return *this;
+        
+    }
+    
+    V& operator [](const K& key) { return emplace(key).first->second; }
+    
+    std::size_t getSize() const noexcept { return size; }
+    std::size_t getCapacity() const noexcept { return capacity; }
+    bool isEmpty() const noexcept { return !size; }
+    
+    V* find(const K& key) noexcept {
+        
+        auto i = findIndex(key);
+        return i != capacity ? &slots[i].get().second : nullptr;
+        
+    }
+    const V* find(const K& key) const noexcept {
+        
+        auto i = findIndex(key);
+        return i != capacity ? &slots[i].get().second : nullptr;
+        
+    }
+    bool contains(const K& key) const noexcept { return findIndex(key) != capacity; }
+    
+    template <typename... Arg>
+    std::pair<Iterator, bool> emplace(const K& key, Arg&&... arg) {
+        
+        auto i = findIndex(key);
+        if(i != capacity) return {{this, i}, false};
+        if((size + 1) * 4 > capacity * 3) rehash(capacity ? capacity * 2 : MIN_CAPACITY);
+        i = insertIndex(hasher(key));
+        new(slots[i].data) EntryType(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Arg>(arg)...));
+        return {{this, i}, true};
+        
+    }
+    std::pair<Iterator, bool> insert(const K& key, const V& value) { return emplace(key, value); }
+    
+    bool erase(const K& key) noexcept {
+        
+        auto i = findIndex(key);
+        if(i == capacity) return false;
+        slots[i].get().~EntryType();
+        auto mask = capacity - 1;
+        for(auto j = (i + 1) & mask; controls[j] != EMPTY; j = (j + 1) & mask) {
+            
+            auto& entry = slots[j].get();
+            auto home = hasher(entry.first) & mask;
+            if(((j - home) & mask) < ((j - i) & mask)) continue;
+            new(slots[i].data) EntryType(std::move(entry));
+            entry.~EntryType();
+            controls[i] = controls[j];
+            i = j;
+            
+        }
+        controls[i] = EMPTY;
+        --size;
+        return true;
+        
+    }
+    
+    void reserve(std::size_t count) {
+        
+        std::size_t newCapacity = MIN_CAPACITY;
+        while(newCapacity * 3 < count * 4) newCapacity *= 2;
+        if(newCapacity > capacity) rehash(newCapacity);
+        
+    }
+    
+    void clear() noexcept { if(capacity) destroy(); }
+    
+    Iterator begin() noexcept { return {this, 0}; }
+    Iterator end() noexcept { return {this, capacity}; }
+    ConstIterator begin() const noexcept { return {this, 0}; }
+    ConstIterator end() const noexcept { return {this, capacity}; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
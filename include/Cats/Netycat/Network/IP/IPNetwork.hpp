@@ -0,0 +1,183 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IP_IPNETWORK_HPP
+#define CATS_NETYCAT_NETWORK_IP_IPNETWORK_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <functional>
+
+#include "Cats/Corecat/Text/String.hpp"
+#include "Cats/Corecat/Util/Exception.hpp"
+#include "Cats/Corecat/Util/Operator.hpp"
+
+#include "IPAddress.hpp"
+#include "../Impl/Hash.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace IP {
+
+class IPNetwork : public Corecat::EqualityOperator<IPNetwork>, public Corecat::RelationalOperator<IPNetwork> {
+    
+private:
+    
+    using String8 = Corecat::String8;
+    
+public:
+    
+    static constexpr std::size_t MAX_STRING_LENGTH = IPAddress::MAX_STRING_LENGTH + 4;
+    
+private:
+    
+    IPAddress address;
+    std::uint8_t prefixLength;
+    
+private:
+    
+    static const std::uint8_t* getBytes(const IPAddress& address) noexcept {
+        
+        return address.getData();
+        
+    }
+    static bool isPrefixEqual(const std::uint8_t* a, const std::uint8_t* b, std::size_t length) noexcept {
+        
+        std::size_t n = length / 8, m = length % 8;
+        if(std::memcmp(a, b, n)) return false;
+        return !m || !((a[n] ^ b[n]) & std::uint8_t(0xFF00 >> m));
+        
+    }
+    
+public:
+    
+    IPNetwork() : prefixLength() {}
+    IPNetwork(const IPAddress& address_, std::size_t prefixLength_) : address(address_), prefixLength(std::uint8_t(prefixLength_)) {
+        
+        if(prefixLength_ > getMaxPrefixLength())
+            throw Corecat::InvalidArgumentException("Invalid prefix length");
+        auto data = address.getData();
+        std::size_t size = address.isIPv4() ? 4 : 16, n = prefixLength / 8, m = prefixLength % 8;
+        if(m) data[n] &= std::uint8_t(0xFF00 >> m), ++n;
+        std::memset(data + n, 0, size - n);
+        
+    }
+    IPNetwork(const IPNetwork& src) = default;
+    
+    IPNetwork& operator =(const IPNetwork& src) = default;
+    
+    friend bool operator ==(const IPNetwork& a, const IPNetwork& b) noexcept { return a.prefixLength == b.prefixLength && a.address == b.address; }
+    friend bool operator <(const IPNetwork& a, const IPNetwork& b) noexcept {
+        
+        return a.address < b.address || (a.address == b.address && a.prefixLength < b.prefixLength);
+        
+    }
+    
+    const IPAddress& getAddress() const noexcept { return address; }
+    std::size_t getPrefixLength() const noexcept { return prefixLength; }
+    std::size_t getMaxPrefixLength() const noexcept { return address.isIPv4() ? 32 : 128; }
+    
+    bool contains(const IPAddress& x) const noexcept {
+        
+        return x.getType() == address.getType() && isPrefixEqual(getBytes(x), getBytes(address), prefixLength);
+        
+    }
+    bool contains(const IPNetwork& x) const noexcept { return x.prefixLength >= prefixLength && contains(x.address); }
+    
+    std::size_t formatTo(char* str) const noexcept {
+        
+        auto p = str + address.formatTo(str);
+        *p++ = '/';
+        if(prefixLength >= 100) *p++ = char('0' + prefixLength / 100);
+        if(prefixLength >= 10) *p++ = char('0' + prefixLength / 10 % 10);
+        *p++ = char('0' + prefixLength % 10);
+        return std::size_t(p - str);
+        
+    }
+    String8 toString() const {
+        
+        char str[MAX_STRING_LENGTH];
+        return String8(str, formatTo(str));
+        
+    }
+    
+    std::uint64_t getHash() const noexcept { return Impl::mixHash(address.getHash(), prefixLength); }
+    
+public:
+    
+    static bool tryParse(const char* str, std::size_t length, IPNetwork& network) noexcept {
+        
+        auto p = static_cast<const char*>(std::memchr(str, '/', length));
+        if(!p) return false;
+        IPAddress address;
+        if(!IPAddress::tryParse(str, std::size_t(p - str), address)) return false;
+        std::size_t prefixLength = 0, n = std::size_t(str + length - ++p);
+        if(!n || n > 3 || (n > 1 && *p == '0')) return false;
+        for(; p != str + length; ++p) {
+            
+            if(*p < '0' || *p > '9') return false;
+            prefixLength = prefixLength * 10 + std::size_t(*p - '0');
+            
+        }
+        if(prefixLength > (address.isIPv4() ? 32 : 128)) return false;
+        network = IPNetwork(address, prefixLength);
+        return true;
+        
+    }
+    static IPNetwork parse(const char* str, std::size_t length) {
+        
+        IPNetwork network;
+        if(!tryParse(str, length, network)) throw Corecat::InvalidArgumentException("Invalid IP network");
+        return network;
+        
+    }
+    static IPNetwork parse(const String8& str) { return parse(str.getData(), str.getLength()); }
+    
+};
+
+}
+}
+}
+}
+
+namespace std {
+
+template <>
+struct hash<Cats::Netycat::IPNetwork> {
+    
+    std::size_t operator ()(const Cats::Netycat::IPNetwork& network) const noexcept { return std::size_t(network.getHash()); }
+    
+};
+
+}
+
+
+#endif
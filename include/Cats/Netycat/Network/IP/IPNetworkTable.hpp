@@ -0,0 +1,136 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IP_IPNETWORKTABLE_HPP
+#define CATS_NETYCAT_NETWORK_IP_IPNETWORKTABLE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <utility>
+#include <vector>
+
+#include "IPAddress.hpp"
+#include "IPNetwork.hpp"
+#include "../Impl/Poptrie.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace IP {
+
+template <typename V>
+class IPNetworkTable {
+    
+private:
+    
+    using Poptrie = Impl::Poptrie;
+    
+private:
+    
+    Poptrie trie4;
+    Poptrie trie6;
+    std::vector<V> values;
+    
+private:
+    
+    static std::uint64_t getKey(const std::uint8_t* data) noexcept {
+        
+        std::uint64_t key = 0;
+        for(std::size_t i = 0; i < 8; ++i) key = (key << 8) | data[i];
+        return key;
+        
+    }
+    
+    const V* getValue(std::uint32_t index) const noexcept { return index == Poptrie::NONE ? nullptr : &values[index]; }
+    
+public:
+    
+    IPNetworkTable() = default;
+    IPNetworkTable(const std::vector<std::pair<IPNetwork, V>>& networks) { build(networks); }
+    IPNetworkTable(const IPNetworkTable& src) = delete;
+    IPNetworkTable(IPNetworkTable&& src) = default;
+    
+    IPNetworkTable& operator =(const IPNetworkTable& src) = delete;
+    IPNetworkTable& operator =(IPNetworkTable&& src) = default;
+    
+    void build(const std::vector<std::pair<IPNetwork, V>>& networks) {
+        
+        std::vector<Poptrie::Entry> entries4, entries6;
+        values.clear();
+        values.reserve(networks.size());
+        for(auto&& x : networks) {
+            
+            auto&& address = x.first.getAddress();
+            auto length = std::uint32_t(x.first.getPrefixLength());
+            auto value = std::uint32_t(values.size());
+            if(address.isIPv4()) entries4.push_back({std::uint64_t(std::uint32_t(address.getIPv4())) << 32, 0, length, value});
+            else {
+                
+                auto data = address.getData();
+                entries6.push_back({getKey(data), getKey(data + 8), length, value});
+                
+            }
+            values.push_back(x.second);
+            
+        }
+        trie4.build(std::move(entries4));
+        trie6.build(std::move(entries6));
+        
+    }
+    
+    const V* find(const IPv4Address& address) const noexcept {
+        
+        return getValue(trie4.find(std::uint64_t(std::uint32_t(address)) << 32, 0));
+        
+    }
+    const V* find(const IPv6Address& address) const noexcept {
+        
+        auto data = address.getData();
+        return getValue(trie6.find(getKey(data), getKey(data + 8)));
+        
+    }
+    const V* find(const IPAddress& address) const noexcept {
+        
+        return address.isIPv4() ? find(address.getIPv4()) : find(address.getIPv6());
+        
+    }
+    bool contains(const IPAddress& address) const noexcept { return find(address) != nullptr; }
+    
+    std::size_t getSize() const noexcept { return values.size(); }
+    bool isEmpty() const noexcept { return values.empty(); }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
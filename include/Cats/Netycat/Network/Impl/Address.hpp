@@ -29,6 +29,7 @@
 
 
 #include "Cats/Corecat/System/OS.hpp"
+#include "Cats/Corecat/Util/Endian.hpp"
 #include "Cats/Corecat/Util/ExceptionPtr.hpp"
 
 #include "../IP/IPAddress.hpp"
@@ -93,8 +94,9 @@ inline void toSockaddr(void* saddr, socklen_t& saddrSize, const IPAddress& addre
         
         if(saddrSize < socklen_t(sizeof(sockaddr_in6)))
             { e = Corecat::InvalidArgumentException("Invalid sockaddr size"); return; }
-        const std::uint8_t* addr = address.getIPv6().getData();
-        std::uint32_t scope = address.getIPv6().getScope();
+        auto v6 = address.getIPv6();
+        const std::uint8_t* addr = v6.getData();
+        std::uint32_t scope = v6.getScope();
         sockaddr_in6* saddr6 = reinterpret_cast<sockaddr_in6*>(saddr);
         *saddr6 = {};
         saddr6->sin6_family = AF_INET6;
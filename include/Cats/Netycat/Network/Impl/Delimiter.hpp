@@ -0,0 +1,101 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IMPL_DELIMITER_HPP
+#define CATS_NETYCAT_NETWORK_IMPL_DELIMITER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+
+#include "../../Impl/SIMD.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+namespace Impl {
+
+inline const Corecat::Byte* findDelimiterScalar(const Corecat::Byte* b, const Corecat::Byte* e, const Corecat::Byte* d, std::size_t n) noexcept {
+    
+    for(auto last = e - n; b <= last; ++b)
+        if(*b == *d && !std::memcmp(b + 1, d + 1, n - 1)) return b;
+    return e;
+    
+}
+
+#if defined(NETYCAT_SIMD_AVX2)
+inline std::uint32_t matchDelimiter(const Corecat::Byte* p, const Corecat::Byte* d, std::size_t n) noexcept {
+    
+    auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + n - 1));
+    auto m = _mm256_and_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(char(d[0]))), _mm256_cmpeq_epi8(y, _mm256_set1_epi8(char(d[n - 1]))));
+    return std::uint32_t(_mm256_movemask_epi8(m));
+    
+}
+constexpr std::size_t DELIMITER_BLOCK_SIZE = 32;
+#elif defined(NETYCAT_SIMD_SSE2)
+inline std::uint32_t matchDelimiter(const Corecat::Byte* p, const Corecat::Byte* d, std::size_t n) noexcept {
+    
+    auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n - 1));
+    auto m = _mm_and_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(char(d[0]))), _mm_cmpeq_epi8(y, _mm_set1_epi8(char(d[n - 1]))));
+    return std::uint32_t(_mm_movemask_epi8(m));
+    
+}
+constexpr std::size_t DELIMITER_BLOCK_SIZE = 16;
+#endif
+
+inline const Corecat::Byte* findDelimiter(const Corecat::Byte* b, const Corecat::Byte* e, const Corecat::Byte* d, std::size_t n) noexcept {
+    
+    if(std::size_t(e - b) < n) return e;
+#if defined(NETYCAT_SIMD_AVX2) || defined(NETYCAT_SIMD_SSE2)
+    constexpr std::size_t N = DELIMITER_BLOCK_SIZE;
+    for(; std::size_t(e - b) >= N + n - 1; b += N) {
+        
+        for(auto m = matchDelimiter(b, d, n); m; m &= m - 1) {
+            
+            auto p = b + SIMD::countTrailingZero(m);
+            if(n <= 2 || !std::memcmp(p + 1, d + 1, n - 2)) return p;
+            
+        }
+        
+    }
+#endif
+    return findDelimiterScalar(b, e, d, n);
+    
+}
+
+}
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IMPL_POPTRIE_HPP
+#define CATS_NETYCAT_NETWORK_IMPL_POPTRIE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+#include "../../Impl/SIMD.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+namespace Impl {
+
+class Poptrie {
+    
+public:
+    
+    struct Entry {
+        
+        std::uint64_t high;
+        std::uint64_t low;
+        std::uint32_t length;
+        std::uint32_t value;
+        
+    };
+    
+    static constexpr std::uint32_t NONE = 0x7FFFFFFF;
+    static constexpr std::size_t STRIDE = 6;
+    static constexpr std::size_t DIRECT_BITS = 18;
+    
+private:
+    
+    static constexpr std::uint32_t LEAF = 0x80000000;
+    
+    struct Node {
+        
+        std::uint64_t vector;
+        std::uint64_t leafvec;
+        std::uint32_t base0;
+        std::uint32_t base1;
+        
+    };
+    
+private:
+    
+    std::vector<std::uint32_t> direct;
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> leaves;
+    
+private:
+    
+    static unsigned extract(std::uint64_t high, std::uint64_t low, std::size_t offset) noexcept {
+        
+        if(offset <= 58) return unsigned(high >> (58 - offset)) & 63;
+        if(offset < 64) return unsigned((high << (offset - 58)) | (low >> (122 - offset))) & 63;
+        if(offset <= 122) return unsigned(low >> (122 - offset)) & 63;
+        return unsigned(low << (offset - 122)) & 63;
+        
+    }
+    
+    void buildNode(std::uint32_t index, const Entry* begin, const Entry* end, std::size_t offset, std::uint32_t value);
+    
+public:
+    
+    Poptrie();
+    
+    void build(std::vector<Entry> entries);
+    
+    std::uint32_t find(std::uint64_t high, std::uint64_t low) const noexcept {
+        
+        auto d = direct[std::size_t(high >> (64 - DIRECT_BITS))];
+        if(d & LEAF) return d & ~LEAF;
+        auto node = &nodes[d];
+        std::size_t offset = DIRECT_BITS;
+        auto v = extract(high, low, offset);
+        while((node->vector >> v) & 1) {
+            
+            node = &nodes[node->base1 + SIMD::countPopulation(node->vector & ((std::uint64_t(2) << v) - 1)) - 1];
+            v = extract(high, low, offset += STRIDE);
+            
+        }
+        return leaves[node->base0 + SIMD::countPopulation(node->leafvec & ((std::uint64_t(2) << v) - 1)) - 1];
+        
+    }
+    
+    std::size_t getNodeCount() const noexcept { return nodes.size(); }
+    std::size_t getLeafCount() const noexcept { return leaves.size(); }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
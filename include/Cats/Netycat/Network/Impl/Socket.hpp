@@ -28,7 +28,11 @@
 #define CATS_NETYCAT_NETWORK_IMPL_SOCKET_HPP
 
 
+#include <atomic>
+#include <memory>
+
 #include "../IP/IPAddress.hpp"
+#include "../../IOBuffer.hpp"
 #include "../../IOExecutor.hpp"
 
 #include "Cats/Corecat/Util/Byte.hpp"
@@ -55,12 +59,17 @@ public:
     using NativeHandleType = SOCKET;
     
     using AcceptCallback = std::function<void(const ExceptionPtr&)>;
+    using AcceptLoopCallback = std::function<void(const ExceptionPtr&, NativeHandleType)>;
     using ConnectCallback = std::function<void(const ExceptionPtr&)>;
     
     using ReadCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
+    using ReadPooledCallback = std::function<void(const ExceptionPtr&, IOBuffer&)>;
     using WriteCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
     
     static constexpr std::size_t DEFAULT_BACKLOG = 128;
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    static constexpr std::size_t ACCEPT_BUFFER_SIZE = (sizeof(sockaddr_storage) + 16) * 2;
+#endif
     
 private:
     
@@ -70,6 +79,7 @@ private:
     int family = 0;
     int type = 0;
     int protocol = 0;
+    std::shared_ptr<std::atomic<bool>> acceptStopped;
 #endif
     
 public:
@@ -79,9 +89,11 @@ public:
     Socket(NativeHandleType handle_);
     Socket(IOExecutor& executor_, NativeHandleType handle_);
     Socket(const Socket& src) = delete;
+    Socket(Socket&& src) noexcept;
     ~Socket();
     
     Socket& operator =(const Socket& src) = delete;
+    Socket& operator =(Socket&& src) noexcept;
     
     void close() noexcept;
     
@@ -97,27 +109,58 @@ public:
     
     void accept(Socket& s, ExceptionPtr& e) noexcept;
     void accept(Socket& s, AcceptCallback cb) noexcept;
+    void acceptLoop(std::size_t count, AcceptLoopCallback cb) noexcept;
+    void acceptLoop(std::size_t count, IOExecutor& target, AcceptLoopCallback cb) noexcept;
     
     std::size_t read(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void read(void* buffer, std::size_t count, ReadCallback cb) noexcept;
+    std::size_t read(IOBuffer& buffer, std::size_t count, ExceptionPtr& e) noexcept;
+    void read(IOBuffer& buffer, std::size_t count, ReadCallback cb) noexcept;
+    void readPooled(ReadPooledCallback cb) noexcept;
     
     std::size_t readAll(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void readAll(void* buffer, std::size_t count, ReadCallback cb) noexcept;
     
     std::size_t readFrom(void* buffer, std::size_t count, void* address, socklen_t& size, ExceptionPtr& e) noexcept;
     void readFrom(void* buffer, std::size_t count, void* address, socklen_t& size, ReadCallback cb) noexcept;
+    std::size_t readFrom(IOBuffer& buffer, std::size_t count, void* address, socklen_t& size, ExceptionPtr& e) noexcept;
+    void readFrom(IOBuffer& buffer, std::size_t count, void* address, socklen_t& size, ReadCallback cb) noexcept;
     
     std::size_t write(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void write(const void* buffer, std::size_t count, WriteCallback cb) noexcept;
+    std::size_t write(const IOBuffer& buffer, ExceptionPtr& e) noexcept;
+    void write(const IOBuffer& buffer, WriteCallback cb) noexcept;
     
     std::size_t writeAll(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void writeAll(const void* buffer, std::size_t count, WriteCallback cb) noexcept;
     
     std::size_t writeTo(const void* buffer, std::size_t count, const void* address, socklen_t size, ExceptionPtr& e) noexcept;
     void writeTo(const void* buffer, std::size_t count, const void* address, socklen_t size, WriteCallback cb) noexcept;
+    std::size_t writeTo(const IOBuffer& buffer, const void* address, socklen_t size, ExceptionPtr& e) noexcept;
+    void writeTo(const IOBuffer& buffer, const void* address, socklen_t size, WriteCallback cb) noexcept;
+    
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    std::size_t transmitFile(HANDLE file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, ExceptionPtr& e) noexcept;
+    void transmitFile(HANDLE file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, WriteCallback cb) noexcept;
+    
+    void connect(const void* address, socklen_t size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+    NativeHandleType beginAccept(void* buffer, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+    void endAccept(Socket& s, NativeHandleType h, const ExceptionPtr& e) noexcept;
+    void read(void* buffer, std::size_t count, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+    void readFrom(void* buffer, std::size_t count, void* address, socklen_t& size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+    void write(const void* buffer, std::size_t count, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+    void writeTo(const void* buffer, std::size_t count, const void* address, socklen_t size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept;
+#endif
     
     void getRemoteEndpoint(void* address, socklen_t& size, ExceptionPtr& e) noexcept;
     
+    bool isReadable(ExceptionPtr& e) noexcept;
+    
+    void setOption(int level, int name, const void* value, socklen_t size, ExceptionPtr& e) noexcept;
+    void getOption(int level, int name, void* value, socklen_t& size, ExceptionPtr& e) noexcept;
+    
+    IOExecutor* getExecutor() noexcept { return executor; }
+    
     NativeHandleType getHandle() noexcept;
     void setHandle(NativeHandleType handle_) noexcept;
     
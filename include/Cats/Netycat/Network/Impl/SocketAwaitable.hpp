@@ -0,0 +1,299 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_IMPL_SOCKETAWAITABLE_HPP
+#define CATS_NETYCAT_NETWORK_IMPL_SOCKETAWAITABLE_HPP
+
+
+#include "Address.hpp"
+#include "Socket.hpp"
+#include "../../Awaitable.hpp"
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+#if defined(NETYCAT_AWAITABLE)
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+namespace Impl {
+
+class SocketConnectAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    sockaddr_storage address;
+    socklen_t size = sizeof(address);
+    
+public:
+    
+    SocketConnectAwaitable(Socket& socket_, int type, int protocol, const IPAddress& address_, std::uint16_t port) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_) {
+        
+        switch(address_.getType()) {
+        case IPAddress::Type::IPv4: socket->socket(AF_INET, type, protocol, exception); if(exception) return; break;
+        case IPAddress::Type::IPv6: socket->socket(AF_INET6, type, protocol, exception); if(exception) return; break;
+        default: exception = Corecat::InvalidArgumentException("Invalid address type"); return;
+        }
+        toSockaddr(&address, size, address_, port, exception);
+        if(exception) socket->close();
+        
+    }
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->connect(&address, size, this, e); });
+        
+    }
+    void await_resume() { rethrow(); }
+    
+};
+
+class SocketAcceptAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    Socket* s;
+    Socket::NativeHandleType h = INVALID_SOCKET;
+    Corecat::Byte buffer[Socket::ACCEPT_BUFFER_SIZE];
+    
+public:
+    
+    SocketAcceptAwaitable(Socket& socket_, Socket& s_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_), s(&s_) {}
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { h = socket->beginAccept(buffer, this, e); });
+        
+    }
+    void await_resume() { socket->endAccept(*s, h, exception); rethrow(); }
+    
+};
+
+class SocketReadAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    void* buffer;
+    std::size_t n;
+    
+public:
+    
+    SocketReadAwaitable(Socket& socket_, void* buffer_, std::size_t n_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_), buffer(buffer_), n(n_) {}
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->read(buffer, n, this, e); });
+        
+    }
+    std::size_t await_resume() { rethrow(); return count; }
+    
+};
+
+class SocketReadAllAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    Corecat::Byte* buffer;
+    std::size_t n;
+    std::size_t total = 0;
+    
+public:
+    
+    SocketReadAllAwaitable(Socket& socket_, void* buffer_, std::size_t n_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resumeAll), socket(&socket_), buffer(static_cast<Corecat::Byte*>(buffer_)), n(n_) {}
+    
+    bool await_ready() const noexcept { return bool(exception) || !n; }
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->read(buffer, n, this, e); });
+        
+    }
+    std::size_t await_resume() { rethrow(); return total; }
+    
+private:
+    
+    static void resumeAll(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count) {
+        
+        auto self = static_cast<SocketReadAllAwaitable*>(operation);
+        self->total += count;
+        if(!e && count && self->total < self->n) {
+            
+            ExceptionPtr e1;
+            static_cast<OVERLAPPED&>(*self) = OVERLAPPED();
+            self->socket->read(self->buffer + self->total, self->n - self->total, self, e1);
+            if(!e1) return;
+            resume(executor, operation, e1, 0);
+            
+        } else if(!e && self->total < self->n) resume(executor, operation, Corecat::IOException("Connection closed"), 0);
+        else resume(executor, operation, e, 0);
+        
+    }
+    
+};
+
+class SocketReadFromAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    void* buffer;
+    std::size_t n;
+    IPAddress* address;
+    std::uint16_t* port;
+    sockaddr_storage saddr;
+    socklen_t saddrSize = sizeof(saddr);
+    
+public:
+    
+    SocketReadFromAwaitable(Socket& socket_, void* buffer_, std::size_t n_, IPAddress& address_, std::uint16_t& port_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_), buffer(buffer_), n(n_), address(&address_), port(&port_) {}
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->readFrom(buffer, n, &saddr, saddrSize, this, e); });
+        
+    }
+    std::size_t await_resume() {
+        
+        rethrow();
+        fromSockaddr(&saddr, saddrSize, *address, *port, exception);
+        rethrow();
+        return count;
+        
+    }
+    
+};
+
+class SocketWriteAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    const void* buffer;
+    std::size_t n;
+    
+public:
+    
+    SocketWriteAwaitable(Socket& socket_, const void* buffer_, std::size_t n_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_), buffer(buffer_), n(n_) {}
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->write(buffer, n, this, e); });
+        
+    }
+    std::size_t await_resume() { rethrow(); return count; }
+    
+};
+
+class SocketWriteAllAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    const Corecat::Byte* buffer;
+    std::size_t n;
+    std::size_t total = 0;
+    
+public:
+    
+    SocketWriteAllAwaitable(Socket& socket_, const void* buffer_, std::size_t n_) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resumeAll), socket(&socket_), buffer(static_cast<const Corecat::Byte*>(buffer_)), n(n_) {}
+    
+    bool await_ready() const noexcept { return bool(exception) || !n; }
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->write(buffer, n, this, e); });
+        
+    }
+    std::size_t await_resume() { rethrow(); return total; }
+    
+private:
+    
+    static void resumeAll(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count) {
+        
+        auto self = static_cast<SocketWriteAllAwaitable*>(operation);
+        self->total += count;
+        if(!e && count && self->total < self->n) {
+            
+            ExceptionPtr e1;
+            static_cast<OVERLAPPED&>(*self) = OVERLAPPED();
+            self->socket->write(self->buffer + self->total, self->n - self->total, self, e1);
+            if(!e1) return;
+            resume(executor, operation, e1, 0);
+            
+        } else resume(executor, operation, e, 0);
+        
+    }
+    
+};
+
+class SocketWriteToAwaitable : public OperationAwaitable {
+    
+private:
+    
+    Socket* socket;
+    const void* buffer;
+    std::size_t n;
+    sockaddr_storage saddr;
+    socklen_t saddrSize = sizeof(saddr);
+    
+public:
+    
+    SocketWriteToAwaitable(Socket& socket_, const void* buffer_, std::size_t n_, const IPAddress& address, std::uint16_t port) noexcept :
+        OperationAwaitable(socket_.getExecutor(), &resume), socket(&socket_), buffer(buffer_), n(n_) {
+        
+        toSockaddr(&saddr, saddrSize, address, port, exception);
+        
+    }
+    
+    bool await_suspend(std::coroutine_handle<> handle_) noexcept {
+        
+        return suspend(handle_, [this](auto& e) { socket->writeTo(buffer, n, &saddr, saddrSize, this, e); });
+        
+    }
+    std::size_t await_resume() { rethrow(); return count; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
+
+
+#endif
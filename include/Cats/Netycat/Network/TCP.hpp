@@ -28,9 +28,16 @@
 #define CATS_NETYCAT_NETWORK_TCP_HPP
 
 
+#include "TCP/BufferedTCPStream.hpp"
+#include "TCP/TCPConnectionPool.hpp"
 #include "TCP/TCPEndpoint.hpp"
+#include "TCP/TCPFrameCodec.hpp"
+#include "TCP/TCPFrameReader.hpp"
+#include "TCP/TCPOption.hpp"
 #include "TCP/TCPServer.hpp"
+#include "TCP/TCPShardedServer.hpp"
 #include "TCP/TCPSocket.hpp"
+#include "TCP/TCPWriteQueue.hpp"
 
 
 #endif
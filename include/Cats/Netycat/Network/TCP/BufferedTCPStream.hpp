@@ -0,0 +1,133 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_BUFFEREDTCPSTREAM_HPP
+#define CATS_NETYCAT_NETWORK_TCP_BUFFEREDTCPSTREAM_HPP
+
+
+#include <cstddef>
+
+#include <functional>
+#include <memory>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+
+#include "TCPSocket.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class BufferedTCPStream {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+public:
+    
+    using ReadCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
+    using WriteCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
+    using FlushCallback = std::function<void(const ExceptionPtr&)>;
+    
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 65536;
+    
+private:
+    
+    TCPSocket& socket;
+    std::unique_ptr<Byte[]> readBuffer;
+    std::size_t readCapacity;
+    std::size_t readBegin = 0;
+    std::size_t readEnd = 0;
+    std::unique_ptr<Byte[]> writeBuffer;
+    std::size_t writeCapacity;
+    std::size_t writeSize = 0;
+    
+private:
+    
+    void compact() noexcept;
+    std::size_t take(void* buffer, std::size_t count) noexcept;
+    std::size_t find(const char* delimiter, std::size_t delimiterLength) const noexcept;
+    
+    void fill(ExceptionPtr& e) noexcept;
+    void fill(FlushCallback cb) noexcept;
+    
+    void readExactlyImpl(Byte* buffer, std::size_t n, ReadCallback cb, std::size_t count) noexcept;
+    void readUntilImpl(Byte* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, std::size_t copied, ReadCallback cb) noexcept;
+    void peekImpl(Byte* buffer, std::size_t count, ReadCallback cb) noexcept;
+    
+public:
+    
+    BufferedTCPStream(TCPSocket& socket_, std::size_t readCapacity_ = DEFAULT_BUFFER_SIZE, std::size_t writeCapacity_ = DEFAULT_BUFFER_SIZE);
+    BufferedTCPStream(const BufferedTCPStream& src) = delete;
+    ~BufferedTCPStream();
+    
+    BufferedTCPStream& operator =(const BufferedTCPStream& src) = delete;
+    
+    std::size_t readExactly(void* buffer, std::size_t count);
+    std::size_t readExactly(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
+    void readExactly(void* buffer, std::size_t count, ReadCallback cb) noexcept;
+    Promise<std::size_t> readExactlyAsync(void* buffer, std::size_t count) noexcept;
+    
+    std::size_t readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength);
+    std::size_t readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, ExceptionPtr& e) noexcept;
+    void readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, ReadCallback cb) noexcept;
+    Promise<std::size_t> readUntilAsync(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength) noexcept;
+    
+    std::size_t peek(void* buffer, std::size_t count);
+    std::size_t peek(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
+    void peek(void* buffer, std::size_t count, ReadCallback cb) noexcept;
+    Promise<std::size_t> peekAsync(void* buffer, std::size_t count) noexcept;
+    
+    std::size_t write(const void* buffer, std::size_t count);
+    std::size_t write(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
+    void write(const void* buffer, std::size_t count, WriteCallback cb) noexcept;
+    Promise<std::size_t> writeAsync(const void* buffer, std::size_t count) noexcept;
+    
+    void flush();
+    void flush(ExceptionPtr& e) noexcept;
+    void flush(FlushCallback cb) noexcept;
+    Promise<> flushAsync() noexcept;
+    
+    std::size_t getReadSize() const noexcept { return readEnd - readBegin; }
+    std::size_t getWriteSize() const noexcept { return writeSize; }
+    
+    TCPSocket& getSocket() noexcept { return socket; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
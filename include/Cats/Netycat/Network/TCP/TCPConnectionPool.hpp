@@ -0,0 +1,107 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPCONNECTIONPOOL_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPCONNECTIONPOOL_HPP
+
+
+#include <cstddef>
+
+#include <functional>
+#include <memory>
+
+#include "Cats/Corecat/Concurrent/Promise.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+
+#include "TCPEndpoint.hpp"
+#include "TCPSocket.hpp"
+#include "../../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPConnectionPool {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+    class State;
+    
+public:
+    
+    using EndpointType = TCPEndpoint;
+    using SocketPtr = std::shared_ptr<TCPSocket>;
+    
+    using CheckoutCallback = std::function<void(const ExceptionPtr&, SocketPtr)>;
+    using WarmUpCallback = std::function<void(const ExceptionPtr&)>;
+    
+    static constexpr std::size_t DEFAULT_MIN_SIZE = 0;
+    static constexpr std::size_t DEFAULT_MAX_SIZE = 16;
+    static constexpr double DEFAULT_IDLE_TIMEOUT = 60.0;
+    static constexpr std::size_t SHARD_COUNT = 16;
+    
+private:
+    
+    std::shared_ptr<State> state;
+    
+public:
+    
+    TCPConnectionPool(std::size_t minSize = DEFAULT_MIN_SIZE, std::size_t maxSize = DEFAULT_MAX_SIZE, double idleTimeout = DEFAULT_IDLE_TIMEOUT);
+    TCPConnectionPool(const TCPConnectionPool& src) = delete;
+    ~TCPConnectionPool();
+    
+    TCPConnectionPool& operator =(const TCPConnectionPool& src) = delete;
+    
+    void checkout(IOExecutor& executor, const EndpointType& endpoint, CheckoutCallback cb);
+    Promise<SocketPtr> checkoutAsync(IOExecutor& executor, const EndpointType& endpoint);
+    void checkin(SocketPtr& socket) noexcept { socket.reset(); }
+    
+    void warmUp(IOExecutor& executor, const EndpointType& endpoint, WarmUpCallback cb);
+    Promise<> warmUpAsync(IOExecutor& executor, const EndpointType& endpoint);
+    
+    void close() noexcept;
+    
+    std::size_t getMinSize() const noexcept;
+    std::size_t getMaxSize() const noexcept;
+    double getIdleTimeout() const noexcept;
+    std::size_t getSize(IOExecutor& executor, const EndpointType& endpoint) const noexcept;
+    std::size_t getIdleCount(IOExecutor& executor, const EndpointType& endpoint) const noexcept;
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -28,7 +28,12 @@
 #define CATS_NETYCAT_NETWORK_TCP_TCPENDPOINT_HPP
 
 
+#include <functional>
+
+#include "Cats/Corecat/Util/Operator.hpp"
+
 #include "../IP/IPAddress.hpp"
+#include "../Impl/Hash.hpp"
 
 
 namespace Cats {
@@ -36,7 +41,7 @@ namespace Netycat {
 inline namespace Network {
 inline namespace TCP {
 
-class TCPEndpoint {
+class TCPEndpoint : public Corecat::EqualityOperator<TCPEndpoint>, public Corecat::RelationalOperator<TCPEndpoint> {
     
 private:
     
@@ -51,6 +56,9 @@ public:
     
     TCPEndpoint& operator =(const TCPEndpoint& src) = default;
     
+    friend bool operator ==(const TCPEndpoint& a, const TCPEndpoint& b) noexcept { return a.port == b.port && a.address == b.address; }
+    friend bool operator <(const TCPEndpoint& a, const TCPEndpoint& b) noexcept { return a.address < b.address || (a.address == b.address && a.port < b.port); }
+    
     const IPAddress& getAddress() const noexcept { return address; }
     IPAddress& getAddress() noexcept { return address; }
     void setAddress(const IPAddress& address_) noexcept { address = address_; }
@@ -59,6 +67,8 @@ public:
     std::uint16_t& getPort() noexcept { return port; }
     void setPort(std::uint16_t port_) noexcept { port = port_; }
     
+    std::uint64_t getHash() const noexcept { return Impl::mixHash(address.getHash(), port); }
+    
 };
 
 }
@@ -66,5 +76,16 @@ public:
 }
 }
 
+namespace std {
+
+template <>
+struct hash<Cats::Netycat::TCPEndpoint> {
+    
+    std::size_t operator ()(const Cats::Netycat::TCPEndpoint& endpoint) const noexcept { return std::size_t(endpoint.getHash()); }
+    
+};
+
+}
+
 
 #endif
@@ -0,0 +1,106 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPFRAMECODEC_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPFRAMECODEC_HPP
+
+
+#include <cstddef>
+
+#include <string>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+#include "Cats/Corecat/Util/ExceptionPtr.hpp"
+
+#include "../../IOBuffer.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPFrameCodec {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+public:
+    
+    enum class Type { FixedLength, VarintLength, Delimiter };
+    
+    static constexpr std::size_t DEFAULT_MAX_FRAME_SIZE = 16777216;
+    static constexpr std::size_t MAX_VARINT_SIZE = 10;
+    
+private:
+    
+    Type type;
+    std::size_t prefixSize;
+    std::size_t maxFrameSize;
+    std::string delimiter;
+    
+private:
+    
+    TCPFrameCodec(Type type_, std::size_t prefixSize_, std::size_t maxFrameSize_, std::string delimiter_ = {}) :
+        type(type_), prefixSize(prefixSize_), maxFrameSize(maxFrameSize_), delimiter(std::move(delimiter_)) {}
+    
+public:
+    
+    TCPFrameCodec(const TCPFrameCodec& src) = default;
+    TCPFrameCodec(TCPFrameCodec&& src) = default;
+    
+    TCPFrameCodec& operator =(const TCPFrameCodec& src) = default;
+    TCPFrameCodec& operator =(TCPFrameCodec&& src) = default;
+    
+    Type getType() const noexcept { return type; }
+    std::size_t getPrefixSize() const noexcept { return prefixSize; }
+    std::size_t getMaxFrameSize() const noexcept { return maxFrameSize; }
+    const std::string& getDelimiter() const noexcept { return delimiter; }
+    std::size_t getHeaderSize() const noexcept { return type == Type::VarintLength ? MAX_VARINT_SIZE : prefixSize; }
+    std::size_t getTrailerSize() const noexcept { return type == Type::Delimiter ? delimiter.size() : 0; }
+    
+    std::size_t decode(const Byte* data, std::size_t size, std::size_t& frameOffset, std::size_t& frameSize, std::size_t& scanned, ExceptionPtr& e) const noexcept;
+    
+    void encode(IOBuffer& frame) const;
+    IOBuffer encode(const void* data, std::size_t count) const;
+    
+public:
+    
+    static TCPFrameCodec fixedLength(std::size_t prefixSize, std::size_t maxFrameSize = DEFAULT_MAX_FRAME_SIZE);
+    static TCPFrameCodec varintLength(std::size_t maxFrameSize = DEFAULT_MAX_FRAME_SIZE) noexcept;
+    static TCPFrameCodec delimited(const char* delimiter, std::size_t delimiterLength, std::size_t maxFrameSize = DEFAULT_MAX_FRAME_SIZE);
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
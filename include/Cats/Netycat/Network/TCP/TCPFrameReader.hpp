@@ -0,0 +1,110 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPFRAMEREADER_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPFRAMEREADER_HPP
+
+
+#include <cstddef>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+
+#include "TCPFrameCodec.hpp"
+#include "TCPSocket.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPFrameReader {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+public:
+    
+    using ReadCallback = std::function<void(const ExceptionPtr&, const Byte*, std::size_t)>;
+    
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 65536;
+    
+private:
+    
+    using FillCallback = std::function<void(const ExceptionPtr&)>;
+    
+private:
+    
+    TCPSocket& socket;
+    TCPFrameCodec codec;
+    std::unique_ptr<Byte[]> buffer;
+    std::size_t capacity;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::size_t scanned = 0;
+    
+private:
+    
+    bool decode(const Byte*& data, std::size_t& size, ExceptionPtr& e) noexcept;
+    void prepare(ExceptionPtr& e) noexcept;
+    void fill(ExceptionPtr& e) noexcept;
+    void fill(FillCallback cb) noexcept;
+    
+public:
+    
+    TCPFrameReader(TCPSocket& socket_, TCPFrameCodec codec_, std::size_t capacity_ = DEFAULT_BUFFER_SIZE);
+    TCPFrameReader(const TCPFrameReader& src) = delete;
+    ~TCPFrameReader();
+    
+    TCPFrameReader& operator =(const TCPFrameReader& src) = delete;
+    
+    std::size_t read(const Byte*& data);
+    std::size_t read(const Byte*& data, ExceptionPtr& e) noexcept;
+    void read(ReadCallback cb) noexcept;
+    Promise<std::pair<const Byte*, std::size_t>> readAsync() noexcept;
+    
+    std::size_t getBufferedSize() const noexcept { return end - begin; }
+    const TCPFrameCodec& getCodec() const noexcept { return codec; }
+    
+    TCPSocket& getSocket() noexcept { return socket; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
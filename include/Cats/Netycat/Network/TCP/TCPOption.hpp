@@ -0,0 +1,80 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPOPTION_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPOPTION_HPP
+
+
+#include <cstddef>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPOption {
+    
+private:
+    
+    int level;
+    int name;
+    int value;
+    
+private:
+    
+    TCPOption(int level_, int name_, int value_) noexcept : level(level_), name(name_), value(value_) {}
+    
+public:
+    
+    TCPOption(const TCPOption& src) = default;
+    
+    TCPOption& operator =(const TCPOption& src) = default;
+    
+    int getLevel() const noexcept { return level; }
+    int getName() const noexcept { return name; }
+    int getValue() const noexcept { return value; }
+    
+public:
+    
+    static TCPOption noDelay(bool enable = true) noexcept;
+    static TCPOption sendBufferSize(std::size_t size) noexcept;
+    static TCPOption receiveBufferSize(std::size_t size) noexcept;
+    static TCPOption keepAlive(bool enable = true) noexcept;
+    static TCPOption keepAliveIdle(double seconds) noexcept;
+    static TCPOption keepAliveInterval(double seconds) noexcept;
+    static TCPOption keepAliveCount(std::size_t count) noexcept;
+    static TCPOption userTimeout(double seconds) noexcept;
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
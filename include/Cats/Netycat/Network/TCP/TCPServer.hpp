@@ -28,6 +28,9 @@
 #define CATS_NETYCAT_NETWORK_TCP_TCPSERVER_HPP
 
 
+#include <vector>
+
+#include "TCPOption.hpp"
 #include "TCPSocket.hpp"
 
 
@@ -50,12 +53,19 @@ public:
     using EndpointType = TCPEndpoint;
     
     using AcceptCallback = std::function<void(const ExceptionPtr&)>;
+    using AcceptLoopCallback = std::function<void(const ExceptionPtr&, TCPSocket&)>;
     
     static constexpr std::size_t DEFAULT_BACKLOG = Impl::Socket::DEFAULT_BACKLOG;
+    static constexpr std::size_t DEFAULT_ACCEPT_COUNT = 16;
     
 private:
     
     Impl::Socket socket;
+    std::vector<TCPOption> options;
+    
+private:
+    
+    void applyOptions(Impl::Socket& s, ExceptionPtr& e) noexcept;
     
 public:
     
@@ -84,6 +94,14 @@ public:
     void accept(TCPSocket& s, ExceptionPtr& e) noexcept;
     void accept(TCPSocket& s, AcceptCallback cb) noexcept;
     Promise<> acceptAsync(TCPSocket& s) noexcept;
+    void acceptLoop(AcceptLoopCallback cb, std::size_t count = DEFAULT_ACCEPT_COUNT) noexcept;
+    void acceptLoop(IOExecutor& executor, AcceptLoopCallback cb, std::size_t count = DEFAULT_ACCEPT_COUNT) noexcept;
+#if defined(NETYCAT_AWAITABLE)
+    Impl::SocketAcceptAwaitable acceptAwait(TCPSocket& s) noexcept { return {socket, s.socket}; }
+#endif
+    
+    void setOption(const TCPOption& option);
+    void setOption(const TCPOption& option, ExceptionPtr& e) noexcept;
     
     NativeHandleType getHandle() noexcept;
     void setHandle(NativeHandleType handle) noexcept;
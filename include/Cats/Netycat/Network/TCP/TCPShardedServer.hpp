@@ -0,0 +1,109 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPSHARDEDSERVER_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPSHARDEDSERVER_HPP
+
+
+#include <cstddef>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "TCPServer.hpp"
+#include "TCPSocket.hpp"
+#include "../../IOExecutor.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPShardedServer {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    
+public:
+    
+    using NativeHandleType = TCPServer::NativeHandleType;
+    using EndpointType = TCPEndpoint;
+    
+    using AcceptCallback = std::function<void(const ExceptionPtr&, IOExecutor&, TCPSocket&)>;
+    
+    static constexpr std::size_t DEFAULT_BACKLOG = TCPServer::DEFAULT_BACKLOG;
+    static constexpr std::size_t DEFAULT_ACCEPT_COUNT = TCPServer::DEFAULT_ACCEPT_COUNT;
+    
+private:
+    
+    std::vector<std::unique_ptr<IOExecutor>> executors;
+    std::vector<std::thread> threads;
+    TCPServer server;
+    AcceptCallback cb;
+    std::atomic<bool> running{};
+    
+private:
+    
+    static std::vector<std::unique_ptr<IOExecutor>> createExecutors(std::size_t shardCount);
+    
+public:
+    
+    TCPShardedServer(std::size_t shardCount = 0);
+    TCPShardedServer(const TCPShardedServer& src) = delete;
+    ~TCPShardedServer();
+    
+    TCPShardedServer& operator =(const TCPShardedServer& src) = delete;
+    
+    void listen(std::uint16_t port, std::size_t backlog = DEFAULT_BACKLOG) { server.listen(port, backlog); }
+    void listen(const IPAddress& address, std::uint16_t port, std::size_t backlog = DEFAULT_BACKLOG) { server.listen(address, port, backlog); }
+    void listen(const EndpointType& endpoint, std::size_t backlog = DEFAULT_BACKLOG) { server.listen(endpoint, backlog); }
+    void listen(std::uint16_t port, std::size_t backlog, ExceptionPtr& e) noexcept { server.listen(port, backlog, e); }
+    void listen(const IPAddress& address, std::uint16_t port, std::size_t backlog, ExceptionPtr& e) noexcept { server.listen(address, port, backlog, e); }
+    void listen(const EndpointType& endpoint, std::size_t backlog, ExceptionPtr& e) noexcept { server.listen(endpoint, backlog, e); }
+    
+    void start(AcceptCallback cb_, std::size_t acceptCount = DEFAULT_ACCEPT_COUNT);
+    void stop();
+    void join();
+    
+    std::size_t getShardCount() const noexcept { return executors.size(); }
+    IOExecutor& getExecutor(std::size_t index) noexcept { return *executors[index]; }
+    
+    NativeHandleType getHandle() noexcept { return server.getHandle(); }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
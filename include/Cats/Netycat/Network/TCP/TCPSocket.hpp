@@ -29,7 +29,11 @@
 
 
 #include "TCPEndpoint.hpp"
+#include "TCPOption.hpp"
 #include "../Impl/Socket.hpp"
+#include "../Impl/SocketAwaitable.hpp"
+#include "../../Filesystem/File.hpp"
+#include "../../IOBuffer.hpp"
 #include "../../IOExecutor.hpp"
 
 
@@ -56,6 +60,7 @@ public:
     using ConnectCallback = std::function<void(const ExceptionPtr&)>;
     
     using ReadCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
+    using ReadPooledCallback = std::function<void(const ExceptionPtr&, IOBuffer&)>;
     using WriteCallback = std::function<void(const ExceptionPtr&, std::size_t)>;
     
 private:
@@ -69,9 +74,11 @@ public:
     TCPSocket(NativeHandleType socket_);
     TCPSocket(IOExecutor& executor_, NativeHandleType socket_);
     TCPSocket(const TCPSocket& src) = delete;
+    TCPSocket(TCPSocket&& src) = default;
     ~TCPSocket();
     
     TCPSocket& operator =(const TCPSocket& src) = delete;
+    TCPSocket& operator =(TCPSocket&& src) = default;
     
     void close() noexcept;
     
@@ -88,6 +95,11 @@ public:
     std::size_t read(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void read(void* buffer, std::size_t count, ReadCallback cb) noexcept;
     Promise<std::size_t> readAsync(void* buffer, std::size_t count) noexcept;
+    std::size_t read(IOBuffer& buffer, std::size_t count);
+    std::size_t read(IOBuffer& buffer, std::size_t count, ExceptionPtr& e) noexcept;
+    void read(IOBuffer& buffer, std::size_t count, ReadCallback cb) noexcept;
+    Promise<std::size_t> readAsync(IOBuffer& buffer, std::size_t count) noexcept;
+    void readPooled(ReadPooledCallback cb) noexcept;
     
     std::size_t readAll(void* buffer, std::size_t count);
     std::size_t readAll(void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
@@ -98,15 +110,42 @@ public:
     std::size_t write(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void write(const void* buffer, std::size_t count, WriteCallback cb) noexcept;
     Promise<std::size_t> writeAsync(const void* buffer, std::size_t count) noexcept;
+    std::size_t write(const IOBuffer& buffer);
+    std::size_t write(const IOBuffer& buffer, ExceptionPtr& e) noexcept;
+    void write(const IOBuffer& buffer, WriteCallback cb) noexcept;
+    Promise<std::size_t> writeAsync(const IOBuffer& buffer) noexcept;
     
     std::size_t writeAll(const void* buffer, std::size_t count);
     std::size_t writeAll(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept;
     void writeAll(const void* buffer, std::size_t count, WriteCallback cb) noexcept;
     Promise<std::size_t> writeAllAsync(const void* buffer, std::size_t count) noexcept;
     
+    std::size_t transmitFile(const File& file, std::uint64_t offset, std::size_t count);
+    std::size_t transmitFile(const File& file, std::uint64_t offset, std::size_t count, ExceptionPtr& e) noexcept;
+    void transmitFile(const File& file, std::uint64_t offset, std::size_t count, WriteCallback cb) noexcept;
+    void transmitFile(const File& file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, WriteCallback cb) noexcept;
+    Promise<std::size_t> transmitFileAsync(const File& file, std::uint64_t offset, std::size_t count) noexcept;
+    
+#if defined(NETYCAT_AWAITABLE)
+    Impl::SocketConnectAwaitable connectAwait(const IPAddress& address, std::uint16_t port) noexcept { return {socket, SOCK_STREAM, IPPROTO_TCP, address, port}; }
+    Impl::SocketConnectAwaitable connectAwait(const EndpointType& endpoint) noexcept { return connectAwait(endpoint.getAddress(), endpoint.getPort()); }
+    Impl::SocketReadAwaitable readAwait(void* buffer, std::size_t count) noexcept { return {socket, buffer, count}; }
+    Impl::SocketReadAllAwaitable readAllAwait(void* buffer, std::size_t count) noexcept { return {socket, buffer, count}; }
+    Impl::SocketWriteAwaitable writeAwait(const void* buffer, std::size_t count) noexcept { return {socket, buffer, count}; }
+    Impl::SocketWriteAllAwaitable writeAllAwait(const void* buffer, std::size_t count) noexcept { return {socket, buffer, count}; }
+#endif
+    
     EndpointType getRemoteEndpoint();
     EndpointType getRemoteEndpoint(ExceptionPtr& e) noexcept;
     
+    bool isReadable();
+    bool isReadable(ExceptionPtr& e) noexcept;
+    
+    void setOption(const TCPOption& option);
+    void setOption(const TCPOption& option, ExceptionPtr& e) noexcept;
+    int getOption(const TCPOption& option);
+    int getOption(const TCPOption& option, ExceptionPtr& e) noexcept;
+    
     NativeHandleType getHandle() noexcept;
     void setHandle(NativeHandleType handle) noexcept;
     
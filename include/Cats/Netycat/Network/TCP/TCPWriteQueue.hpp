@@ -0,0 +1,119 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef CATS_NETYCAT_NETWORK_TCP_TCPWRITEQUEUE_HPP
+#define CATS_NETYCAT_NETWORK_TCP_TCPWRITEQUEUE_HPP
+
+
+#include <cstddef>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "TCPSocket.hpp"
+#include "../../IOBuffer.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPWriteQueue {
+    
+private:
+    
+    using ExceptionPtr = Corecat::ExceptionPtr;
+    template <typename T = void>
+    using Promise = Corecat::Promise<T>;
+    
+public:
+    
+    using WritabilityCallback = std::function<void(bool)>;
+    using ErrorCallback = std::function<void(const ExceptionPtr&)>;
+    using FlushCallback = std::function<void(const ExceptionPtr&)>;
+    
+    static constexpr std::size_t DEFAULT_HIGH_WATERMARK = 1048576;
+    static constexpr std::size_t DEFAULT_LOW_WATERMARK = 262144;
+    
+private:
+    
+    TCPSocket& socket;
+    std::size_t highWatermark;
+    std::size_t lowWatermark;
+    IOBuffer pending;
+    IOBuffer sending;
+    std::size_t size = 0;
+    bool writing = false;
+    bool writable = true;
+    ExceptionPtr exception;
+    WritabilityCallback writabilityCallback;
+    ErrorCallback errorCallback;
+    std::vector<FlushCallback> flushList;
+    std::shared_ptr<bool> alive;
+    
+private:
+    
+    bool enqueue(std::size_t count);
+    void send();
+    void complete(const ExceptionPtr& e, std::size_t count);
+    void fail(const ExceptionPtr& e);
+    
+public:
+    
+    TCPWriteQueue(TCPSocket& socket_, std::size_t highWatermark_ = DEFAULT_HIGH_WATERMARK, std::size_t lowWatermark_ = DEFAULT_LOW_WATERMARK);
+    TCPWriteQueue(const TCPWriteQueue& src) = delete;
+    ~TCPWriteQueue();
+    
+    TCPWriteQueue& operator =(const TCPWriteQueue& src) = delete;
+    
+    bool write(const void* buffer, std::size_t count);
+    bool write(IOBuffer&& buffer);
+    
+    void flush(FlushCallback cb);
+    Promise<> flushAsync();
+    
+    void setWritabilityCallback(WritabilityCallback cb) { writabilityCallback = std::move(cb); }
+    void setErrorCallback(ErrorCallback cb) { errorCallback = std::move(cb); }
+    
+    std::size_t getSize() const noexcept { return size; }
+    std::size_t getHighWatermark() const noexcept { return highWatermark; }
+    std::size_t getLowWatermark() const noexcept { return lowWatermark; }
+    bool isWritable() const noexcept { return writable; }
+    const ExceptionPtr& getException() const noexcept { return exception; }
+    
+    TCPSocket& getSocket() noexcept { return socket; }
+    
+};
+
+}
+}
+}
+}
+
+
+#endif
@@ -30,7 +30,9 @@
 
 #include "UDPEndpoint.hpp"
 #include "../Impl/Socket.hpp"
+#include "../Impl/SocketAwaitable.hpp"
 #include "../Win32/WSA.hpp"
+#include "../../IOBuffer.hpp"
 #include "../../IOExecutor.hpp"
 
 
@@ -93,6 +95,14 @@ public:
     Promise<std::pair<std::size_t, EndpointType>> readFromAsync(void* buffer, std::size_t count) noexcept;
     Promise<std::size_t> readFromAsync(void* buffer, std::size_t count, IPAddress& address, std::uint16_t& port) noexcept;
     Promise<std::size_t> readFromAsync(void* buffer, std::size_t count, EndpointType& endpoint) noexcept;
+    std::size_t readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint);
+    std::size_t readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint, ExceptionPtr& e) noexcept;
+    void readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint, ReadCallback cb) noexcept;
+    Promise<std::size_t> readFromAsync(IOBuffer& buffer, std::size_t count, EndpointType& endpoint) noexcept;
+#if defined(NETYCAT_AWAITABLE)
+    Impl::SocketReadFromAwaitable readFromAwait(void* buffer, std::size_t count, IPAddress& address, std::uint16_t& port) noexcept { return {socket, buffer, count, address, port}; }
+    Impl::SocketReadFromAwaitable readFromAwait(void* buffer, std::size_t count, EndpointType& endpoint) noexcept { return readFromAwait(buffer, count, endpoint.getAddress(), endpoint.getPort()); }
+#endif
     
     std::size_t writeTo(const void* buffer, std::size_t count, const IPAddress& address, std::uint16_t port);
     std::size_t writeTo(const void* buffer, std::size_t count, const EndpointType& endpoint);
@@ -102,6 +112,14 @@ public:
     void writeTo(const void* buffer, std::size_t count, const EndpointType& endpoint, WriteCallback cb) noexcept;
     Promise<std::size_t> writeToAsync(const void* buffer, std::size_t count, const IPAddress& address, std::uint16_t port) noexcept;
     Promise<std::size_t> writeToAsync(const void* buffer, std::size_t count, const EndpointType& endpoint) noexcept;
+    std::size_t writeTo(const IOBuffer& buffer, const EndpointType& endpoint);
+    std::size_t writeTo(const IOBuffer& buffer, const EndpointType& endpoint, ExceptionPtr& e) noexcept;
+    void writeTo(const IOBuffer& buffer, const EndpointType& endpoint, WriteCallback cb) noexcept;
+    Promise<std::size_t> writeToAsync(const IOBuffer& buffer, const EndpointType& endpoint) noexcept;
+#if defined(NETYCAT_AWAITABLE)
+    Impl::SocketWriteToAwaitable writeToAwait(const void* buffer, std::size_t count, const IPAddress& address, std::uint16_t port) noexcept { return {socket, buffer, count, address, port}; }
+    Impl::SocketWriteToAwaitable writeToAwait(const void* buffer, std::size_t count, const EndpointType& endpoint) noexcept { return writeToAwait(buffer, count, endpoint.getAddress(), endpoint.getPort()); }
+#endif
     
     NativeHandleType getHandle() noexcept;
     void setHandle(NativeHandleType handle) noexcept;
@@ -51,6 +51,7 @@ public:
     static void getExtensionFunction(SOCKET socket, GUID guid, void** p);
     static LPFN_ACCEPTEX AcceptEx;
     static LPFN_CONNECTEX ConnectEx;
+    static LPFN_TRANSMITFILE TransmitFile;
     
 private:
     
@@ -26,77 +26,230 @@
 
 #include "Cats/Netycat/Filesystem/Directory.hpp"
 
+#include <cerrno>
+#include <cstring>
+#include <cwchar>
+
+#include "Cats/Corecat/Util/Byte.hpp"
 #include "Cats/Corecat/Util/Exception.hpp"
 
+#include "Cats/Netycat/Filesystem/Impl/Status.hpp"
+
+#if defined(CORECAT_OS_WINDOWS)
+#   include "Cats/Corecat/Win32/Windows.hpp"
+#elif defined(CORECAT_OS_LINUX)
+#   include <dirent.h>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
 
 namespace Cats {
 namespace Netycat {
 inline namespace Filesystem {
 
-void Directory::Iterator::FindDeleter::operator ()(HANDLE handle) const noexcept { ::FindClose(handle); }
+namespace {
+
+template <typename C>
+bool isDotName(const C* name) noexcept { return name[0] == '.' && (!name[1] || (name[1] == '.' && !name[2])); }
+
+}
+
+#if defined(CORECAT_OS_WINDOWS)
+struct Directory::Iterator::State {
+    
+    HANDLE handle = INVALID_HANDLE_VALUE;
+    WIN32_FIND_DATAW data;
+    
+    ~State() { if(handle != INVALID_HANDLE_VALUE) ::FindClose(handle); }
+    
+};
 
 Directory::Iterator::Iterator(const FilePath& path_) : path(path_) {
     
     auto str = path.getString();
     str += str.isEmpty() || (!str.endsWith(L'\\') && !str.endsWith(L'/') && !str.endsWith(L':')) ? L"\\*" : L"*";
-    WIN32_FIND_DATAW data;
-    auto handle_ = ::FindFirstFileW(str.getData(), &data);
-    if(handle_ == INVALID_HANDLE_VALUE) {
+    auto s = std::make_shared<State>();
+    s->handle = ::FindFirstFileExW(str.getData(), FindExInfoBasic, &s->data, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if(s->handle == INVALID_HANDLE_VALUE) {
         
-        if(GetLastError() == ERROR_FILE_NOT_FOUND) { handle = nullptr; return; }
-        throw Corecat::SystemException("::FindFirstFileW failed");
+        if(GetLastError() == ERROR_FILE_NOT_FOUND) return;
+        throw Corecat::SystemException("::FindFirstFileExW failed");
         
     }
-    handle = {handle_, FindDeleter()};
-    name = reinterpret_cast<char16_t*>(data.cFileName);
-    if(name == L"." || name == L"..") ++*this;
-    else if(handle) name = path / name;
+    state = std::move(s);
+    if(isDotName(state->data.cFileName)) next();
     
 }
+Directory::Iterator::Iterator(const FilePath& path_, const std::shared_ptr<void>& /*parent*/) : Iterator(path_) {}
 
-Directory::Iterator& Directory::Iterator::operator ++() {
+void Directory::Iterator::next() {
     
-    while(true) {
+    nameValid = false;
+    statusValid = false;
+    do {
         
-        WIN32_FIND_DATAW data;
-        if(!::FindNextFileW(handle.get(), &data)) {
+        if(!::FindNextFileW(state->handle, &state->data)) {
             
-            if(GetLastError() == ERROR_NO_MORE_FILES) { handle = nullptr; break; }
+            if(GetLastError() == ERROR_NO_MORE_FILES) { state = nullptr; break; }
             else throw Corecat::SystemException("::FindNextFileW failed");
             
         }
-        name = reinterpret_cast<char16_t*>(data.cFileName);
-        if(name != L"." && name != L"..") { name = path / name; break; }
+        
+    } while(isDotName(state->data.cFileName));
+    
+}
+
+Directory::Iterator::StringViewType Directory::Iterator::getName() const noexcept {
+    
+    return {reinterpret_cast<const FilePath::CharType*>(state->data.cFileName), std::wcslen(state->data.cFileName)};
+    
+}
+
+FileType Directory::Iterator::getType() const {
+    
+    auto& data = state->data;
+    if((data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) && IsReparseTagNameSurrogate(data.dwReserved0)) return FileType::SYMLINK;
+    else if(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) return FileType::DIRECTORY;
+    else return FileType::FILE;
+    
+}
+
+const FileStatus& Directory::Iterator::getStatus() const {
+    
+    if(!statusValid) {
+        
+        auto& data = state->data;
+        auto time = (std::uint64_t(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+        status.type = getType();
+        status.size = (std::uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        status.modifyTime = (std::int64_t(time) - 116444736000000000) * 100;
+        status.inode = 0;
+        statusValid = true;
         
     }
-    return *this;
+    return status;
     
 }
+#elif defined(CORECAT_OS_LINUX)
+struct Directory::Iterator::State {
+    
+    int fd = -1;
+    std::unique_ptr<Corecat::Byte[]> buffer{new Corecat::Byte[BUFFER_SIZE]};
+    std::size_t position = 0;
+    std::size_t size = 0;
+    const dirent64* entry = nullptr;
+    
+    ~State() { if(fd >= 0) ::close(fd); }
+    
+};
 
+Directory::Iterator::Iterator(const FilePath& path_) : path(path_) {
+    
+    auto s = std::make_shared<State>();
+    if((s->fd = ::open(path.isEmpty() ? "." : path.getData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0)
+        throw Corecat::SystemException("::open failed");
+    state = std::move(s);
+    next();
+    
+}
+Directory::Iterator::Iterator(const FilePath& path_, const std::shared_ptr<void>& parent) : path(path_) {
+    
+    if(!parent || !path.hasFilename()) {
+        
+        *this = Iterator(path_);
+        return;
+        
+    }
+    auto s = std::make_shared<State>();
+    auto name = path.getData() + path.getString().getLength() - path.getFilenameString().getLength();
+    if((s->fd = ::openat(static_cast<State*>(parent.get())->fd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0)
+        throw Corecat::SystemException("::openat failed");
+    state = std::move(s);
+    next();
+    
+}
 
-RecursiveDirectory::Iterator::Iterator(const FilePath& path) {
+void Directory::Iterator::next() {
     
-    Directory dir(path);
-    auto b = dir.begin(), e = dir.end();
-    if(b != e) {
+    nameValid = false;
+    statusValid = false;
+    while(true) {
         
-        stack.emplace_back(dir, b);
-        name = *b;
+        if(state->position == state->size) {
+            
+            long ret = ::syscall(SYS_getdents64, state->fd, state->buffer.get(), BUFFER_SIZE);
+            if(ret < 0) throw Corecat::SystemException("getdents64 failed");
+            if(ret == 0) { state = nullptr; return; }
+            state->position = 0;
+            state->size = std::size_t(ret);
+            
+        }
+        auto entry = reinterpret_cast<const dirent64*>(state->buffer.get() + state->position);
+        state->position += entry->d_reclen;
+        if(!isDotName(entry->d_name)) { state->entry = entry; return; }
         
     }
     
 }
 
+Directory::Iterator::StringViewType Directory::Iterator::getName() const noexcept {
+    
+    return {state->entry->d_name, std::strlen(state->entry->d_name)};
+    
+}
+
+FileType Directory::Iterator::getType() const {
+    
+    switch(state->entry->d_type) {
+    case DT_REG: return FileType::FILE;
+    case DT_DIR: return FileType::DIRECTORY;
+    case DT_LNK: return FileType::SYMLINK;
+    case DT_UNKNOWN: return getStatus().type;
+    default: return FileType::OTHER;
+    }
+    
+}
+
+const FileStatus& Directory::Iterator::getStatus() const {
+    
+    if(!statusValid) {
+        
+        auto entry = state->entry;
+        if(!Impl::getStatus(state->fd, entry->d_name, status)) {
+            
+            if(errno != ENOENT) throw Corecat::SystemException("::statx failed");
+            status = {FileType::NOT_FOUND, 0, 0, entry->d_ino};
+            
+        }
+        statusValid = true;
+        
+    }
+    return status;
+    
+}
+#endif
+
+
+RecursiveDirectory::Iterator::Iterator(const FilePath& path) {
+    
+    Directory dir(path);
+    auto b = dir.begin(), e = dir.end();
+    if(b != e) stack.emplace_back(dir, b);
+    
+}
+
 RecursiveDirectory::Iterator& RecursiveDirectory::Iterator::operator ++() {
     
-    if(FileInfo::isDirectory(name)) {
+    if(stack.back().second.getType() == FileType::DIRECTORY) {
         
-        Directory dir(name);
+        Directory dir(*stack.back().second);
         auto b = dir.begin(), e = dir.end();
         if(b != e) {
             
             stack.emplace_back(dir, b);
-            name = *b;
             return *this;
             
         }
@@ -110,7 +263,6 @@ RecursiveDirectory::Iterator& RecursiveDirectory::Iterator::operator ++() {
         ++stack.back().second;
         
     }
-    name = *stack.back().second;
     return *this;
     
 }
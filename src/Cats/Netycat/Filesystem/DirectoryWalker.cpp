@@ -0,0 +1,208 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Filesystem/DirectoryWalker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+namespace {
+
+struct Task {
+    
+    FilePath path;
+    std::size_t depth;
+    std::shared_ptr<void> parent;
+    
+};
+
+struct Worker {
+    
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    
+};
+
+}
+
+struct DirectoryWalker::Context {
+    
+    VisitCallback cb;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> queued{0};
+    std::atomic<std::size_t> sleeping{0};
+    std::atomic<bool> stopped{false};
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    
+    void push(std::size_t index, Task task) {
+        
+        ++pending;
+        {
+            std::lock_guard<std::mutex> lock(workers[index]->mutex);
+            workers[index]->tasks.emplace_back(std::move(task));
+        }
+        ++queued;
+        if(sleeping) {
+            
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idleCondition.notify_one();
+            
+        }
+        
+    }
+    
+    bool pop(std::size_t index, Task& task) {
+        
+        auto& worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if(worker.tasks.empty()) return false;
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        --queued;
+        return true;
+        
+    }
+    
+    bool steal(std::size_t index, Task& task) {
+        
+        for(std::size_t i = 1; i < workers.size(); ++i) {
+            
+            auto& worker = *workers[(index + i) % workers.size()];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if(worker.tasks.empty()) continue;
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            --queued;
+            return true;
+            
+        }
+        return false;
+        
+    }
+    
+    void finish() {
+        
+        if(--pending == 0) {
+            
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idleCondition.notify_all();
+            
+        }
+        
+    }
+    
+    void fail(std::exception_ptr e) {
+        
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if(!error) error = std::move(e);
+        }
+        stopped = true;
+        std::lock_guard<std::mutex> lock(idleMutex);
+        idleCondition.notify_all();
+        
+    }
+    
+};
+
+void DirectoryWalker::process(Context& context, std::size_t index) {
+    
+    Task task;
+    if(!context.pop(index, task) && !context.steal(index, task)) return;
+    try {
+        
+        for(Directory::Iterator it(task.path, task.parent), end; it != end && !context.stopped; ++it) {
+            
+            if(context.cb(Entry(it, task.depth)) && it.getType() == FileType::DIRECTORY)
+                context.push(index, {*it, task.depth + 1, it.state});
+            
+        }
+        
+    } catch(...) { context.fail(std::current_exception()); }
+    context.finish();
+    
+}
+
+void DirectoryWalker::run(Context& context, std::size_t index) {
+    
+    while(!context.stopped && context.pending) {
+        
+        if(context.queued) { process(context, index); continue; }
+        std::unique_lock<std::mutex> lock(context.idleMutex);
+        ++context.sleeping;
+        context.idleCondition.wait(lock, [&] { return context.stopped || !context.pending || context.queued; });
+        --context.sleeping;
+        
+    }
+    
+}
+
+
+DirectoryWalker::DirectoryWalker(std::size_t threadCount_) : threadCount(threadCount_) {
+    
+    if(!threadCount) threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    
+}
+
+void DirectoryWalker::walk(const FilePath& path, VisitCallback cb) {
+    
+    Context context;
+    context.cb = std::move(cb);
+    for(std::size_t i = 0; i < threadCount; ++i) context.workers.emplace_back(new Worker);
+    context.push(0, {path, 0, nullptr});
+    
+    std::vector<std::thread> threads;
+    try {
+        
+        for(std::size_t i = 1; i < threadCount; ++i) threads.emplace_back(&DirectoryWalker::run, std::ref(context), i);
+        
+    } catch(...) { context.fail(std::current_exception()); }
+    run(context, 0);
+    for(auto&& thread : threads) thread.join();
+    
+    if(context.error) std::rethrow_exception(context.error);
+    
+}
+
+}
+}
+}
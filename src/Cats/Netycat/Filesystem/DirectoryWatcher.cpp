@@ -0,0 +1,178 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Filesystem/DirectoryWatcher.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+DirectoryWatcher::DirectoryWatcher(IOExecutor& executor_, const FilePath& path_, bool recursive_) :
+    executor(&executor_), path(path_), recursive(recursive_),
+    buffer(new std::uint32_t[BUFFER_SIZE / sizeof(std::uint32_t)], std::default_delete<std::uint32_t[]>()),
+    alive(std::make_shared<bool>(true)) {
+    
+    DWORD share = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+    if(!(handle = ::CreateFileW(path.getData(), FILE_LIST_DIRECTORY, share, nullptr, OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr)))
+        throw Corecat::IOException("::CreateFileW failed");
+    executor->attachHandle(handle);
+    
+}
+DirectoryWatcher::~DirectoryWatcher() {
+    
+    *alive = false;
+    ::CancelIoEx(handle, nullptr);
+    
+}
+
+std::vector<DirectoryWatcher::Event> DirectoryWatcher::parse(std::size_t count) {
+    
+    std::vector<Event> events;
+    if(!count) {
+        
+        oldName = {};
+        events.push_back({EventType::QUEUE_OVERFLOW, {}, {}});
+        return events;
+        
+    }
+    std::unordered_map<std::basic_string<FilePath::CharType>, std::size_t> last;
+    std::vector<bool> dropped;
+    std::size_t droppedCount = 0;
+    auto push = [&](EventType type, FilePath name, FilePath old, std::basic_string<FilePath::CharType>& key) {
+        
+        last[std::move(key)] = events.size();
+        events.push_back({type, std::move(name), std::move(old)});
+        dropped.push_back(false);
+        
+    };
+    auto p = reinterpret_cast<const Corecat::Byte*>(buffer.get());
+    while(true) {
+        
+        auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(p);
+        auto data = reinterpret_cast<const FilePath::CharType*>(info->FileName);
+        std::size_t length = info->FileNameLength / sizeof(WCHAR);
+        FilePath name(FilePath::StringViewType(data, length));
+        std::basic_string<FilePath::CharType> key(data, length);
+        auto it = last.find(key);
+        auto previous = it != last.end() ? &events[it->second] : nullptr;
+        switch(info->Action) {
+        case FILE_ACTION_ADDED: push(EventType::ADDED, std::move(name), {}, key); break;
+        case FILE_ACTION_REMOVED: {
+            
+            if(previous && previous->type == EventType::ADDED) {
+                
+                dropped[it->second] = true;
+                ++droppedCount;
+                last.erase(it);
+                
+            } else if(previous && previous->type == EventType::MODIFIED) previous->type = EventType::REMOVED;
+            else push(EventType::REMOVED, std::move(name), {}, key);
+            break;
+            
+        }
+        case FILE_ACTION_MODIFIED: {
+            
+            if(!previous || (previous->type != EventType::ADDED && previous->type != EventType::MODIFIED))
+                push(EventType::MODIFIED, std::move(name), {}, key);
+            break;
+            
+        }
+        case FILE_ACTION_RENAMED_OLD_NAME: oldName = std::move(name); break;
+        case FILE_ACTION_RENAMED_NEW_NAME: {
+            
+            last.erase(std::basic_string<FilePath::CharType>(oldName.getData(), oldName.getString().getLength()));
+            push(EventType::RENAMED, std::move(name), std::move(oldName), key);
+            oldName = {};
+            break;
+            
+        }
+        default: break;
+        }
+        if(!info->NextEntryOffset) break;
+        p += info->NextEntryOffset;
+        
+    }
+    if(droppedCount) {
+        
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < events.size(); ++i)
+            if(!dropped[i]) events[j++] = std::move(events[i]);
+        events.resize(j);
+        
+    }
+    return events;
+    
+}
+
+void DirectoryWatcher::read(ReadCallback cb) noexcept {
+    
+    auto self = this;
+    auto alive = this->alive;
+    auto overlapped = executor->createOverlapped([=, retained = buffer](auto& e, auto count) {
+        
+        if(e) cb(e, {});
+        else if(!*alive) cb(Corecat::IOException("Operation aborted"), {});
+        else cb({}, self->parse(count));
+        
+    });
+    DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE
+        | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION;
+    if(!::ReadDirectoryChangesW(handle, buffer.get(), DWORD(BUFFER_SIZE), recursive, filter, nullptr, overlapped, nullptr)
+        && GetLastError() != ERROR_IO_PENDING) {
+        
+        executor->destroyOverlapped(overlapped);
+        cb(Corecat::IOException("::ReadDirectoryChangesW failed"), {});
+        return;
+        
+    }
+    
+}
+Corecat::Promise<std::vector<DirectoryWatcher::Event>> DirectoryWatcher::readAsync() noexcept {
+    
+    Promise<std::vector<Event>> promise;
+    read([=](auto& e, auto events) {
+        e ? promise.reject(e) : promise.resolve(std::move(events));
+    });
+    return promise;
+    
+}
+
+void DirectoryWatcher::cancel() noexcept {
+    
+    ::CancelIoEx(handle, nullptr);
+    
+}
+
+}
+}
+}
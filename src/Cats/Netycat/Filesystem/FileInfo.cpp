@@ -24,35 +24,119 @@
  *
  */
 
-#include "Cats/Netycat/Filesystem/Directory.hpp"
+#include "Cats/Netycat/Filesystem/FileInfo.hpp"
+
+#include <cerrno>
 
 #include "Cats/Corecat/Util/Exception.hpp"
 
+#include "Cats/Netycat/Filesystem/Impl/Status.hpp"
+
+#if defined(CORECAT_OS_WINDOWS)
+#   include "Cats/Corecat/Win32/Handle.hpp"
+#   include "Cats/Corecat/Win32/Windows.hpp"
+#elif defined(CORECAT_OS_LINUX)
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <sys/statvfs.h>
+#   include <unistd.h>
+#endif
+
 
 namespace Cats {
 namespace Netycat {
 inline namespace Filesystem {
 
-FileType FileInfo::getType(const FilePath& path) {
+#if defined(CORECAT_OS_WINDOWS)
+namespace {
+
+bool isNameSurrogate(const FilePath& path) {
+    
+    WIN32_FIND_DATAW data;
+    HANDLE handle = ::FindFirstFileExW(path.getData(), FindExInfoBasic, &data, FindExSearchNameMatch, nullptr, 0);
+    if(handle == INVALID_HANDLE_VALUE) return false;
+    ::FindClose(handle);
+    return IsReparseTagNameSurrogate(data.dwReserved0);
     
-    DWORD attribute = ::GetFileAttributesW(path.getData());
-    if(attribute == INVALID_FILE_ATTRIBUTES) {
+}
+
+bool getStatus(const FilePath& path, FileStatus& status, bool followSymlink) {
+    
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if(!::GetFileAttributesExW(path.getData(), GetFileExInfoStandard, &data)) {
         
-        if(GetLastError() == ERROR_FILE_NOT_FOUND) return FileType::NOT_FOUND;
-        else throw Corecat::SystemException("::GetFileAttributesW failed");
+        auto error = GetLastError();
+        if(error != ERROR_FILE_NOT_FOUND && error != ERROR_PATH_NOT_FOUND) return false;
+        status = {FileType::NOT_FOUND, 0, 0, 0};
+        return true;
         
     }
-    if(attribute & FILE_ATTRIBUTE_DIRECTORY) return FileType::DIRECTORY;
-    else return FileType::FILE;
+    status.type = data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ? FileType::DIRECTORY : FileType::FILE;
+    if((data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) && isNameSurrogate(path)) {
+        
+        if(followSymlink) {
+            
+            Corecat::Handle handle;
+            if(!(handle = ::CreateFileW(path.getData(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr))) {
+                
+                auto error = GetLastError();
+                if(error != ERROR_FILE_NOT_FOUND && error != ERROR_PATH_NOT_FOUND) return false;
+                status = {FileType::NOT_FOUND, 0, 0, 0};
+                return true;
+                
+            }
+            BY_HANDLE_FILE_INFORMATION info;
+            if(!::GetFileInformationByHandle(handle, &info)) return false;
+            status.type = info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ? FileType::DIRECTORY : FileType::FILE;
+            data.ftLastWriteTime = info.ftLastWriteTime;
+            data.nFileSizeHigh = info.nFileSizeHigh, data.nFileSizeLow = info.nFileSizeLow;
+            
+        } else status.type = FileType::SYMLINK;
+        
+    }
+    auto time = (std::uint64_t(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    status.size = (std::uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    status.modifyTime = (std::int64_t(time) - 116444736000000000) * 100;
+    status.inode = 0;
+    return true;
+    
+}
+
+}
+
+FileType FileInfo::getType(const FilePath& path, bool followSymlink) {
+    
+    FileStatus status;
+    if(!Filesystem::getStatus(path, status, followSymlink))
+        throw Corecat::SystemException("::GetFileAttributesExW failed");
+    return status.type;
     
 }
 
 std::uint64_t FileInfo::getSize(const FilePath& path) {
     
-    WIN32_FILE_ATTRIBUTE_DATA data;
-    if(!::GetFileAttributesExW(path.getData(), GetFileExInfoStandard, &data))
+    FileStatus status;
+    if(!Filesystem::getStatus(path, status, true) || status.type == FileType::NOT_FOUND)
+        throw Corecat::SystemException("::GetFileAttributesExW failed");
+    return status.size;
+    
+}
+
+FileStatus FileInfo::getStatus(const FilePath& path, bool followSymlink) {
+    
+    FileStatus status;
+    if(!Filesystem::getStatus(path, status, followSymlink))
         throw Corecat::SystemException("::GetFileAttributesExW failed");
-    return (std::uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    return status;
+    
+}
+
+void FileInfo::getStatus(const FilePath& base, const FilePath* paths, std::size_t count, FileStatus* statuses, bool followSymlink) {
+    
+    for(std::size_t i = 0; i < count; ++i)
+        if(!Filesystem::getStatus(base / paths[i], statuses[i], followSymlink))
+            throw Corecat::SystemException("::GetFileAttributesExW failed");
     
 }
 
@@ -68,6 +152,82 @@ SpaceInfo FileInfo::getSpace(const FilePath& path) {
     return space;
     
 }
+#elif defined(CORECAT_OS_LINUX)
+namespace {
+
+bool getStatus(int fd, const FilePath& path, FileStatus& status, bool followSymlink) {
+    
+    if(!Impl::getStatus(fd, path.isEmpty() ? "." : path.getData(), status, followSymlink)) {
+        
+        if(errno != ENOENT && errno != ENOTDIR) return false;
+        status = {FileType::NOT_FOUND, 0, 0, 0};
+        
+    }
+    return true;
+    
+}
+
+}
+
+FileType FileInfo::getType(const FilePath& path, bool followSymlink) {
+    
+    FileStatus status;
+    if(!Filesystem::getStatus(AT_FDCWD, path, status, followSymlink))
+        throw Corecat::SystemException("::statx failed");
+    return status.type;
+    
+}
+
+std::uint64_t FileInfo::getSize(const FilePath& path) {
+    
+    FileStatus status;
+    if(!Filesystem::getStatus(AT_FDCWD, path, status, true) || status.type == FileType::NOT_FOUND)
+        throw Corecat::SystemException("::statx failed");
+    return status.size;
+    
+}
+
+FileStatus FileInfo::getStatus(const FilePath& path, bool followSymlink) {
+    
+    FileStatus status;
+    if(!Filesystem::getStatus(AT_FDCWD, path, status, followSymlink))
+        throw Corecat::SystemException("::statx failed");
+    return status;
+    
+}
+
+void FileInfo::getStatus(const FilePath& base, const FilePath* paths, std::size_t count, FileStatus* statuses, bool followSymlink) {
+    
+    int fd = AT_FDCWD;
+    if(!base.isEmpty() && (fd = ::open(base.getData(), O_PATH | O_DIRECTORY | O_CLOEXEC)) < 0)
+        throw Corecat::SystemException("::open failed");
+    for(std::size_t i = 0; i < count; ++i) {
+        
+        if(!Filesystem::getStatus(fd, paths[i], statuses[i], followSymlink)) {
+            
+            if(fd != AT_FDCWD) ::close(fd);
+            throw Corecat::SystemException("::statx failed");
+            
+        }
+        
+    }
+    if(fd != AT_FDCWD) ::close(fd);
+    
+}
+
+SpaceInfo FileInfo::getSpace(const FilePath& path) {
+    
+    struct statvfs st;
+    if(::statvfs(path.getData(), &st))
+        throw Corecat::SystemException("::statvfs failed");
+    SpaceInfo space;
+    space.capacity = std::uint64_t(st.f_blocks) * st.f_frsize;
+    space.free = std::uint64_t(st.f_bfree) * st.f_frsize;
+    space.available = std::uint64_t(st.f_bavail) * st.f_frsize;
+    return space;
+    
+}
+#endif
 
 }
 }
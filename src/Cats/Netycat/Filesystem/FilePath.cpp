@@ -0,0 +1,161 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Filesystem/FilePath.hpp"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+namespace {
+
+using CharType = FilePath::CharType;
+using StringViewType = FilePath::StringViewType;
+
+constexpr CharType DOT = '.';
+
+bool isDot(const CharType* p, std::size_t n) noexcept { return n == 1 && p[0] == DOT; }
+bool isDotDot(const CharType* p, std::size_t n) noexcept { return n == 2 && p[0] == DOT && p[1] == DOT; }
+
+void split(StringViewType str, std::vector<StringViewType>& components) {
+    
+    auto p = str.getData(), e = p + str.getLength();
+    while(p != e) {
+        
+        auto q = Impl::findSeparator(p, e);
+        if(q != p && !isDot(p, q - p)) components.emplace_back(p, q - p);
+        p = q == e ? e : q + 1;
+        
+    }
+    
+}
+
+}
+
+FilePath FilePath::normalize() const {
+    
+    if(data.isEmpty()) return {};
+    
+    struct Component {
+        
+        std::size_t offset;
+        bool dotDot;
+        
+    };
+    std::vector<Component> components;
+    
+    StringType str;
+    str.setLength(data.getLength() + 1);
+    auto begin = str.getData(), out = begin;
+    const CharType* in = data.getData();
+    const CharType* end = in + data.getLength();
+    
+    out = std::copy(in, in + rootLength, out);
+    if(hasRootDirectory()) *out++ = SEPARATOR;
+    auto base = out;
+    
+    bool trailing = false;
+    for(auto p = in + rootDirectoryLength; p != end; ) {
+        
+        auto q = Impl::findSeparator(p, end);
+        std::size_t n = q - p;
+        if(!n) {}
+        else if(isDot(p, n)) trailing = true;
+        else if(isDotDot(p, n) && !components.empty() && !components.back().dotDot) {
+            
+            out = base + components.back().offset;
+            components.pop_back();
+            trailing = true;
+            
+        } else if(isDotDot(p, n) && hasRootDirectory() && components.empty()) trailing = true;
+        else {
+            
+            components.push_back({std::size_t(out - base), isDotDot(p, n)});
+            if(out != base) *out++ = SEPARATOR;
+            out = std::copy(p, q, out);
+            trailing = q != end;
+            
+        }
+        p = q == end ? end : q + 1;
+        
+    }
+    if(!components.empty() && trailing && !components.back().dotDot) *out++ = SEPARATOR;
+    if(out == begin) *out++ = DOT;
+    str.setLength(out - begin);
+    return FilePath(std::move(str));
+    
+}
+
+FilePath FilePath::lexicallyRelative(const FilePath& base) const {
+    
+    auto a = normalize(), b = base.normalize();
+    if(a.getRootString() != b.getRootString() || a.isAbsolute() != b.isAbsolute() || (!a.hasRootDirectory() && b.hasRootDirectory()))
+        return {};
+    
+    std::vector<StringViewType> x, y;
+    split(a.getRelativePathString(), x);
+    split(b.getRelativePathString(), y);
+    auto m = std::mismatch(x.begin(), x.end(), y.begin(), y.end());
+    std::size_t n = 0;
+    for(auto p = m.second; p != y.end(); ++p) {
+        
+        if(isDotDot(p->getData(), p->getLength())) return {};
+        ++n;
+        
+    }
+    
+    StringType str;
+    if(!n && m.first == x.end()) str += DOT;
+    for(std::size_t i = 0; i < n; ++i) {
+        
+        if(i) str += SEPARATOR;
+        str += DOT, str += DOT;
+        
+    }
+    for(auto p = m.first; p != x.end(); ++p) {
+        
+        if(!str.isEmpty()) str += SEPARATOR;
+        str += *p;
+        
+    }
+    if(m.first != x.end() && !a.hasFilename()) str += SEPARATOR;
+    return FilePath(std::move(str));
+    
+}
+FilePath FilePath::lexicallyProximate(const FilePath& base) const {
+    
+    auto path = lexicallyRelative(base);
+    return path.isEmpty() ? *this : path;
+    
+}
+
+}
+}
+}
@@ -0,0 +1,166 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Filesystem/FilePathTable.hpp"
+
+#include <algorithm>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+namespace {
+
+template <typename Node>
+bool needSeparator(const Node* node) noexcept {
+    
+    auto c = node->name[node->nameLength - 1];
+#if defined(CORECAT_OS_WINDOWS)
+    if(!node->parent && c == L':') return false;
+#endif
+    return !FilePath::isSeparator(c);
+    
+}
+
+}
+
+FilePath InternedFilePath::getPath() const {
+    
+    FilePath::StringType str;
+    getPath(str);
+    return FilePath(std::move(str));
+    
+}
+void InternedFilePath::getPath(FilePath::StringType& str) const {
+    
+    str.setLength(getLength());
+    auto p = str.getData() + getLength();
+    for(auto n = node; n; n = n->parent) {
+        
+        p -= n->nameLength;
+        std::copy(n->name, n->name + n->nameLength, p);
+        if(n->parent && n->parent->length + n->nameLength != n->length) *--p = FilePath::SEPARATOR;
+        
+    }
+    
+}
+
+
+const FilePathTable::CharType* FilePathTable::store(StringViewType name) {
+    
+    auto length = name.getLength() + 1;
+    if(length > blockSize) {
+        
+        auto size = std::max(length, std::size_t(BLOCK_SIZE));
+        blocks.emplace_back(new CharType[size]);
+        blockData = blocks.back().get();
+        blockSize = size;
+        
+    }
+    auto data = blockData;
+    std::copy(name.begin(), name.end(), data);
+    data[name.getLength()] = 0;
+    blockData += length;
+    blockSize -= length;
+    return data;
+    
+}
+
+const FilePathTable::Node* FilePathTable::insert(const Node* parent, StringViewType name) {
+    
+    auto it = map.find({parent, name});
+    if(it != map.end()) return it->second;
+    auto data = store(name);
+    std::size_t length = name.getLength();
+    if(parent) {
+        
+        length += parent->length;
+        if(needSeparator(parent)) ++length;
+        
+    }
+    nodes.push_back({parent, data, name.getLength(), length, parent ? parent->depth + 1 : 0});
+    auto node = &nodes.back();
+    map.emplace(Key{parent, {data, name.getLength()}}, node);
+    return node;
+    
+}
+
+InternedFilePath FilePathTable::intern(InternedFilePath parent, StringViewType name) {
+    
+    if(name.isEmpty()) return parent;
+    std::lock_guard<std::mutex> lock(mutex);
+    return insert(parent.node, name);
+    
+}
+InternedFilePath FilePathTable::intern(const FilePath& path) {
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    const Node* node = nullptr;
+    auto root = path.getRootDirectoryString();
+    if(!root.isEmpty()) node = insert(nullptr, root);
+    auto relative = path.getRelativePathString();
+    auto b = relative.begin(), e = relative.end();
+    while(b != e) {
+        
+        auto p = std::find_if(b, e, FilePath::isSeparator);
+        if(p != b) node = insert(node, {b, std::size_t(p - b)});
+        b = p == e ? e : p + 1;
+        
+    }
+    return node;
+    
+}
+
+InternedFilePath FilePathTable::find(InternedFilePath parent, StringViewType name) const {
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = map.find({parent.node, name});
+    return it != map.end() ? it->second : nullptr;
+    
+}
+
+std::size_t FilePathTable::getSize() const {
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    return nodes.size();
+    
+}
+
+void FilePathTable::clear() {
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    map.clear();
+    nodes.clear();
+    blocks.clear();
+    blockData = nullptr;
+    blockSize = 0;
+    
+}
+
+}
+}
+}
@@ -0,0 +1,264 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Filesystem/MappedRingBuffer.hpp"
+
+#include <cstring>
+
+#include <thread>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Filesystem {
+
+namespace {
+
+constexpr std::uint64_t alignRecord(std::uint64_t size) noexcept { return (size + 7) & ~std::uint64_t(7); }
+
+}
+
+MappedRingBuffer::MappedRingBuffer(MappedFile& file, const String8& name, Mode mode_) : mode(mode_) {
+    
+    std::uint64_t size = file.getSize();
+    if(size < sizeof(Header) + RECORD_HEADER_SIZE * 4)
+        throw Corecat::InvalidArgumentException("Mapped file is too small");
+    header = reinterpret_cast<Header*>(file.getData());
+    data = file.getData() + sizeof(Header);
+    
+    std::uint32_t magic = 0;
+    if(header->magic.compare_exchange_strong(magic, INITIALIZING)) {
+        
+        std::uint64_t c = 1;
+        while(c * 2 <= size - sizeof(Header)) c *= 2;
+        header->mode = std::uint32_t(mode);
+        header->capacity = c;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->waiting.store(0, std::memory_order_relaxed);
+        std::memset(data, 0, std::size_t(c));
+        header->magic.store(MAGIC, std::memory_order_release);
+        
+    } else {
+        
+        while((magic = header->magic.load(std::memory_order_acquire)) == INITIALIZING) std::this_thread::yield();
+        if(magic != MAGIC)
+            throw Corecat::InvalidArgumentException("Invalid ring buffer header");
+        if(header->mode != std::uint32_t(mode))
+            throw Corecat::InvalidArgumentException("Ring buffer mode mismatch");
+        
+    }
+    capacity = header->capacity;
+    mask = capacity - 1;
+    
+    Corecat::WString eventName(L"Local\\Netycat.MappedRingBuffer.");
+    eventName += Corecat::WString(name);
+    if(!(event = ::CreateEventW(nullptr, FALSE, FALSE, eventName.getData())))
+        throw Corecat::IOException("::CreateEventW failed");
+    if(!(cancelEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr)))
+        throw Corecat::IOException("::CreateEventW failed");
+    
+}
+MappedRingBuffer::~MappedRingBuffer() {
+    
+    close();
+    std::unique_lock<std::mutex> lock(waitMutex);
+    waitCondition.wait(lock, [&] { return !waitCount; });
+    
+}
+
+void MappedRingBuffer::close() noexcept {
+    
+    closed = true;
+    ::SetEvent(cancelEvent);
+    
+}
+
+bool MappedRingBuffer::isEmpty() const noexcept {
+    
+    std::uint64_t position = header->head.load(std::memory_order_relaxed);
+    return !(getRecordHeader(position & mask).load(std::memory_order_acquire) & COMMITTED);
+    
+}
+
+bool MappedRingBuffer::tryWrite(const void* buffer, std::size_t count) {
+    
+    if(count > getMaxFrameSize())
+        throw Corecat::InvalidArgumentException("Frame is too large");
+    std::uint64_t need = alignRecord(RECORD_HEADER_SIZE + count);
+    std::uint64_t position = header->tail.load(std::memory_order_relaxed);
+    std::uint64_t offset, total;
+    while(true) {
+        
+        offset = position & mask;
+        std::uint64_t contiguous = capacity - offset;
+        total = need <= contiguous ? need : contiguous + need;
+        std::uint64_t head = cachedHead.load(std::memory_order_relaxed);
+        if(position + total - head > capacity) {
+            
+            head = header->head.load(std::memory_order_acquire);
+            cachedHead.store(head, std::memory_order_relaxed);
+            if(position + total - head > capacity) return false;
+            
+        }
+        if(mode == Mode::SINGLE_PRODUCER) {
+            
+            header->tail.store(position + total, std::memory_order_relaxed);
+            break;
+            
+        }
+        if(header->tail.compare_exchange_weak(position, position + total, std::memory_order_relaxed)) break;
+        
+    }
+    if(total != need) {
+        
+        getRecordHeader(offset).store(COMMITTED | PADDING, std::memory_order_release);
+        offset = 0;
+        
+    }
+    std::memcpy(data + offset + RECORD_HEADER_SIZE, buffer, count);
+    getRecordHeader(offset).store(COMMITTED | std::uint32_t(count), std::memory_order_release);
+    notify();
+    return true;
+    
+}
+
+const Corecat::Byte* MappedRingBuffer::peek(std::size_t& count) noexcept {
+    
+    std::uint64_t position = header->head.load(std::memory_order_relaxed);
+    while(true) {
+        
+        std::uint64_t offset = position & mask;
+        std::uint32_t word = getRecordHeader(offset).load(std::memory_order_acquire);
+        if(!(word & COMMITTED)) return nullptr;
+        if(!(word & PADDING)) {
+            
+            count = word & SIZE_MASK;
+            return data + offset + RECORD_HEADER_SIZE;
+            
+        }
+        release(position, capacity - offset);
+        position += capacity - offset;
+        
+    }
+    
+}
+void MappedRingBuffer::pop() noexcept {
+    
+    std::size_t count;
+    if(!peek(count)) return;
+    release(header->head.load(std::memory_order_relaxed), alignRecord(RECORD_HEADER_SIZE + count));
+    
+}
+
+void MappedRingBuffer::wait(IOExecutor& executor, WaitCallback cb) {
+    
+    if(closed) {
+        
+        executor.execute([cb = std::move(cb)] { cb(Corecat::IOException("Ring buffer is closed")); });
+        return;
+        
+    }
+    header->waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(!isEmpty()) {
+        
+        header->waiting.store(0, std::memory_order_relaxed);
+        executor.execute([cb = std::move(cb)] { cb({}); });
+        return;
+        
+    }
+    HANDLE handles[] = {event, cancelEvent};
+    auto self = this;
+    {
+        
+        std::lock_guard<std::mutex> lock(waitMutex);
+        ++waitCount;
+        
+    }
+    executor.beginWork();
+    executor.getThreadPool().execute([=, &executor, cb = std::move(cb)] {
+        
+        ExceptionPtr e;
+        while(true) {
+            
+            DWORD ret = ::WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+            if(ret == WAIT_OBJECT_0 + 1) {
+                
+                e = Corecat::IOException("Ring buffer is closed");
+                break;
+                
+            }
+            if(ret != WAIT_OBJECT_0) {
+                
+                e = Corecat::IOException("::WaitForMultipleObjects failed");
+                break;
+                
+            }
+            if(!self->isEmpty()) break;
+            self->header->waiting.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(!self->isEmpty()) break;
+            
+        }
+        self->header->waiting.store(0, std::memory_order_relaxed);
+        executor.execute([cb = std::move(cb), e = std::move(e)] { cb(e); });
+        executor.endWork();
+        std::lock_guard<std::mutex> lock(self->waitMutex);
+        if(!--self->waitCount) self->waitCondition.notify_all();
+        
+    });
+    
+}
+Corecat::Promise<> MappedRingBuffer::waitAsync(IOExecutor& executor) {
+    
+    Promise<> promise;
+    wait(executor, [=](auto& e) {
+        e ? promise.reject(e) : promise.resolve();
+    });
+    return promise;
+    
+}
+
+void MappedRingBuffer::release(std::uint64_t position, std::uint64_t size) noexcept {
+    
+    std::uint64_t offset = position & mask;
+    getRecordHeader(offset).store(0, std::memory_order_relaxed);
+    std::memset(data + offset + RECORD_HEADER_SIZE, 0, std::size_t(size - RECORD_HEADER_SIZE));
+    header->head.store(position + size, std::memory_order_release);
+    
+}
+void MappedRingBuffer::notify() noexcept {
+    
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(header->waiting.load(std::memory_order_relaxed) && header->waiting.exchange(0))
+        ::SetEvent(event);
+    
+}
+
+}
+}
+}
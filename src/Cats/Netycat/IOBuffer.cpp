@@ -0,0 +1,351 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/IOBuffer.hpp"
+#include "Cats/Netycat/IOBufferPool.hpp"
+
+#include <cstring>
+
+#include <mutex>
+#include <new>
+
+
+namespace Cats {
+namespace Netycat {
+
+namespace {
+
+constexpr std::size_t SIZE_CLASS[] = {2048, 16384, 65536};
+constexpr std::size_t SIZE_CLASS_COUNT = sizeof(SIZE_CLASS) / sizeof(*SIZE_CLASS);
+constexpr std::size_t SLAB_BLOCK_COUNT = 16;
+
+struct BlockPool {
+    
+    std::mutex mutex;
+    std::vector<void*> freeList;
+    
+};
+
+BlockPool* getBlockPool() noexcept {
+    
+    static BlockPool pool[SIZE_CLASS_COUNT];
+    return pool;
+    
+}
+
+void* allocateBlock(std::size_t sizeClass) {
+    
+    auto& pool = getBlockPool()[sizeClass];
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if(pool.freeList.empty()) {
+        
+        auto blockSize = SIZE_CLASS[sizeClass];
+        auto slab = static_cast<Corecat::Byte*>(::operator new(blockSize * SLAB_BLOCK_COUNT));
+        pool.freeList.reserve(pool.freeList.size() + SLAB_BLOCK_COUNT);
+        for(std::size_t i = SLAB_BLOCK_COUNT; i--; )
+            pool.freeList.push_back(slab + blockSize * i);
+        
+    }
+    auto p = pool.freeList.back();
+    pool.freeList.pop_back();
+    return p;
+    
+}
+
+void deallocateBlock(void* p, std::size_t sizeClass) noexcept {
+    
+    auto& pool = getBlockPool()[sizeClass];
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.freeList.push_back(p);
+    
+}
+
+}
+
+IOBuffer::Block* IOBuffer::createBlock(std::size_t capacity) {
+    
+    auto total = sizeof(Block) + capacity;
+    std::size_t sizeClass = 0;
+    while(sizeClass < SIZE_CLASS_COUNT && SIZE_CLASS[sizeClass] < total) ++sizeClass;
+    void* p;
+    if(sizeClass < SIZE_CLASS_COUNT) {
+        
+        p = allocateBlock(sizeClass);
+        total = SIZE_CLASS[sizeClass];
+        
+    } else p = ::operator new(total);
+    auto block = new(p) Block;
+    block->refCount.store(1, std::memory_order_relaxed);
+    block->capacity = total - sizeof(Block);
+    block->sizeClass = sizeClass;
+    block->pool = nullptr;
+    return block;
+    
+}
+void IOBuffer::releaseBlock(Block* block) noexcept {
+    
+    if(--block->refCount) return;
+    if(block->pool) { IOBufferPool::releaseBlock(block); return; }
+    auto sizeClass = block->sizeClass;
+    block->~Block();
+    if(sizeClass < SIZE_CLASS_COUNT) deallocateBlock(block, sizeClass);
+    else ::operator delete(block);
+    
+}
+
+IOBuffer::IOBuffer(Block* block) {
+    
+    segments.push_back({block, 0, 0});
+    
+}
+IOBuffer::IOBuffer(std::size_t capacity, std::size_t headroom) {
+    
+    auto block = createBlock(headroom + capacity);
+    segments.push_back({block, headroom, headroom});
+    
+}
+IOBuffer::IOBuffer(const void* data, std::size_t count, std::size_t headroom, std::size_t tailroom) : size(count) {
+    
+    auto block = createBlock(headroom + count + tailroom);
+    segments.push_back({block, headroom, headroom + count});
+    std::memcpy(block->getData() + headroom, data, count);
+    
+}
+IOBuffer::IOBuffer(IOBuffer&& src) noexcept : segments(std::move(src.segments)), size(src.size) {
+    
+    src.segments.clear();
+    src.size = 0;
+    
+}
+IOBuffer::~IOBuffer() {
+    
+    clear();
+    
+}
+
+IOBuffer& IOBuffer::operator =(IOBuffer&& src) noexcept {
+    
+    if(this != &src) {
+        
+        clear();
+        segments = std::move(src.segments), size = src.size;
+        src.segments.clear();
+        src.size = 0;
+        
+    }
+    return *this;
+    
+}
+
+std::size_t IOBuffer::getHeadroom() const noexcept {
+    
+    if(segments.empty()) return 0;
+    auto& segment = segments.front();
+    if(segment.block->refCount.load(std::memory_order_acquire) != 1) return 0;
+    return segment.begin;
+    
+}
+std::size_t IOBuffer::getTailroom() const noexcept {
+    
+    if(segments.empty()) return 0;
+    auto& segment = segments.back();
+    if(segment.block->refCount.load(std::memory_order_acquire) != 1) return 0;
+    return segment.block->capacity - segment.end;
+    
+}
+
+Corecat::Byte* IOBuffer::prepend(std::size_t count) {
+    
+    if(segments.empty() || getHeadroom() < count) {
+        
+        auto block = createBlock(count);
+        auto capacity = block->capacity;
+        segments.insert(segments.begin(), {block, capacity, capacity});
+        
+    }
+    auto& segment = segments.front();
+    segment.begin -= count;
+    size += count;
+    return segment.block->getData() + segment.begin;
+    
+}
+Corecat::Byte* IOBuffer::reserve(std::size_t count) {
+    
+    if(segments.empty() || getTailroom() < count) {
+        
+        auto block = createBlock(count > DEFAULT_BLOCK_SIZE ? count : DEFAULT_BLOCK_SIZE);
+        if(!segments.empty() && segments.back().begin == segments.back().end) {
+            
+            releaseBlock(segments.back().block);
+            segments.back() = {block, 0, 0};
+            
+        } else segments.push_back({block, 0, 0});
+        
+    }
+    auto& segment = segments.back();
+    return segment.block->getData() + segment.end;
+    
+}
+void IOBuffer::commit(std::size_t count) noexcept {
+    
+    segments.back().end += count;
+    size += count;
+    
+}
+void IOBuffer::append(const void* data, std::size_t count) {
+    
+    auto p = static_cast<const Byte*>(data);
+    if(auto n = getTailroom()) {
+        
+        if(n > count) n = count;
+        auto& segment = segments.back();
+        std::memcpy(segment.block->getData() + segment.end, p, n);
+        segment.end += n, size += n;
+        p += n, count -= n;
+        
+    }
+    if(count) {
+        
+        std::memcpy(reserve(count), p, count);
+        commit(count);
+        
+    }
+    
+}
+void IOBuffer::append(IOBuffer&& buffer) {
+    
+    if(this == &buffer || buffer.segments.empty()) return;
+    if(!segments.empty() && segments.back().begin == segments.back().end) {
+        
+        releaseBlock(segments.back().block);
+        segments.pop_back();
+        
+    }
+    segments.insert(segments.end(), buffer.segments.begin(), buffer.segments.end());
+    size += buffer.size;
+    buffer.segments.clear();
+    buffer.size = 0;
+    
+}
+
+IOBuffer IOBuffer::split(std::size_t count) {
+    
+    if(count > size) count = size;
+    IOBuffer buffer;
+    std::size_t i = 0;
+    for(auto n = count; n; ++i) {
+        
+        auto& segment = segments[i];
+        auto segmentSize = segment.end - segment.begin;
+        if(segmentSize > n) {
+            
+            retainBlock(segment.block);
+            buffer.segments.push_back({segment.block, segment.begin, segment.begin + n});
+            segment.begin += n;
+            break;
+            
+        }
+        buffer.segments.push_back(segment);
+        n -= segmentSize;
+        
+    }
+    segments.erase(segments.begin(), segments.begin() + i);
+    buffer.size = count;
+    size -= count;
+    return buffer;
+    
+}
+void IOBuffer::trimFront(std::size_t count) noexcept {
+    
+    if(count > size) count = size;
+    size -= count;
+    std::size_t i = 0;
+    for(; count; ++i) {
+        
+        auto& segment = segments[i];
+        auto segmentSize = segment.end - segment.begin;
+        if(segmentSize > count) { segment.begin += count; break; }
+        count -= segmentSize;
+        releaseBlock(segment.block);
+        
+    }
+    segments.erase(segments.begin(), segments.begin() + i);
+    
+}
+void IOBuffer::trimBack(std::size_t count) noexcept {
+    
+    if(count > size) count = size;
+    size -= count;
+    while(count) {
+        
+        auto& segment = segments.back();
+        auto segmentSize = segment.end - segment.begin;
+        if(segmentSize > count) { segment.end -= count; break; }
+        count -= segmentSize;
+        releaseBlock(segment.block);
+        segments.pop_back();
+        
+    }
+    
+}
+IOBuffer IOBuffer::clone() const {
+    
+    IOBuffer buffer;
+    buffer.segments = segments;
+    buffer.size = size;
+    for(auto& segment : segments) retainBlock(segment.block);
+    return buffer;
+    
+}
+void IOBuffer::clear() noexcept {
+    
+    for(auto& segment : segments) releaseBlock(segment.block);
+    segments.clear();
+    size = 0;
+    
+}
+
+std::size_t IOBuffer::copyTo(void* buffer, std::size_t count, std::size_t offset) const noexcept {
+    
+    auto p = static_cast<Byte*>(buffer);
+    std::size_t ret = 0;
+    for(auto& segment : segments) {
+        
+        if(!count) break;
+        auto segmentSize = segment.end - segment.begin;
+        if(offset >= segmentSize) { offset -= segmentSize; continue; }
+        auto n = segmentSize - offset;
+        if(n > count) n = count;
+        std::memcpy(p, segment.block->getData() + segment.begin + offset, n);
+        p += n, ret += n, count -= n, offset = 0;
+        
+    }
+    return ret;
+    
+}
+
+}
+}
@@ -0,0 +1,107 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/IOBufferPool.hpp"
+
+#include <new>
+
+
+namespace Cats {
+namespace Netycat {
+
+void IOBufferPool::releaseState(State* state, std::unique_lock<std::mutex>& lock) noexcept {
+    
+    if(--state->refCount) return;
+    lock.unlock();
+    for(auto slab : state->slabList) ::operator delete(slab);
+    delete state;
+    
+}
+void IOBufferPool::releaseBlock(Block* block) noexcept {
+    
+    auto state = static_cast<State*>(block->pool);
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->freeList.push_back(block);
+    releaseState(state, lock);
+    
+}
+
+IOBufferPool::IOBufferPool(std::size_t bufferSize) : state(new State) {
+    
+    state->bufferSize = bufferSize;
+    
+}
+IOBufferPool::~IOBufferPool() {
+    
+    std::unique_lock<std::mutex> lock(state->mutex);
+    releaseState(state, lock);
+    
+}
+
+IOBuffer IOBufferPool::acquire() {
+    
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if(state->freeList.empty()) {
+        
+        auto blockSize = (sizeof(Block) + state->bufferSize + alignof(Block) - 1) / alignof(Block) * alignof(Block);
+        auto slab = static_cast<Corecat::Byte*>(::operator new(blockSize * SLAB_BUFFER_COUNT));
+        state->slabList.push_back(slab);
+        state->freeList.reserve(state->freeList.size() + SLAB_BUFFER_COUNT);
+        for(std::size_t i = SLAB_BUFFER_COUNT; i--; ) {
+            
+            auto block = new(slab + blockSize * i) Block;
+            block->capacity = state->bufferSize;
+            block->sizeClass = 0;
+            block->pool = state;
+            state->freeList.push_back(block);
+            
+        }
+        state->bufferCount += SLAB_BUFFER_COUNT;
+        
+    }
+    auto block = state->freeList.back();
+    state->freeList.pop_back();
+    block->refCount.store(1, std::memory_order_relaxed);
+    ++state->refCount;
+    return IOBuffer(block);
+    
+}
+
+std::size_t IOBufferPool::getBufferCount() const noexcept {
+    
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->bufferCount;
+    
+}
+std::size_t IOBufferPool::getFreeCount() const noexcept {
+    
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->freeList.size();
+    
+}
+
+}
+}
@@ -77,6 +77,13 @@ void IOExecutor::run() {
         auto now = Corecat::HighResolutionClock::now();
         while(timerQueue.size() && timerQueue.top().timePoint <= now) {
             
+            if(auto operation = timerQueue.top().operation) {
+                
+                timerQueue.pop();
+                operation->complete(*this, operation, {}, 0);
+                continue;
+                
+            }
             timerQueue.top().cb();
             timerQueue.pop();
             
@@ -91,9 +98,8 @@ void IOExecutor::run() {
                 
                 Corecat::ExceptionPtr e;
                 if(!success) e = Corecat::IOException("::GetQueuedCompletionStatus failed");
-                Overlapped* overlapped = static_cast<Overlapped*>(o);
-                overlapped->cb(e, byteCount);
-                destroyOverlapped(overlapped);
+                Operation* operation = static_cast<Operation*>(o);
+                operation->complete(*this, operation, e, byteCount);
                 
             }
             
@@ -113,6 +119,11 @@ void IOExecutor::attachHandle(HANDLE handle) {
     if(::CreateIoCompletionPort(handle, completionPort, 0, 0) != completionPort)
         throw Corecat::IOException("::CreateIoCompletionPort failed");
     
+}
+void IOExecutor::wait(double time, Operation* operation) {
+    
+    timerQueue.emplace(Corecat::HighResolutionClock::now() + std::chrono::duration<double>(time), operation);
+    
 }
 IOExecutor::Overlapped* IOExecutor::createOverlapped(OverlappedCallback cb) {
     
@@ -120,11 +131,49 @@ IOExecutor::Overlapped* IOExecutor::createOverlapped(OverlappedCallback cb) {
     ++overlappedCount;
     return overlapped;
     
+}
+IOExecutor::PersistentOverlapped* IOExecutor::createPersistentOverlapped(PersistentOverlappedCallback cb) {
+    
+    return new PersistentOverlapped(std::move(cb));
+    
+}
+void IOExecutor::resetOverlapped(PersistentOverlapped* overlapped) {
+    
+    static_cast<OVERLAPPED&>(*overlapped) = OVERLAPPED();
+    ++overlappedCount;
+    
+}
+void IOExecutor::post(Operation* operation) {
+    
+    if(!::PostQueuedCompletionStatus(completionPort, 0, 0, operation))
+        throw Corecat::IOException("::PostQueuedCompletionStatus failed");
+    
 }
 void IOExecutor::destroyOverlapped(Overlapped* overlapped) {
     
-    delete overlapped;
     --overlappedCount;
+    delete overlapped;
+    
+}
+void IOExecutor::destroyOverlapped(PersistentOverlapped* overlapped) {
+    
+    delete overlapped;
+    
+}
+
+void IOExecutor::completeOverlapped(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count) {
+    
+    Overlapped* overlapped = static_cast<Overlapped*>(operation);
+    overlapped->cb(e, count);
+    executor.destroyOverlapped(overlapped);
+    
+}
+void IOExecutor::completePersistentOverlapped(IOExecutor& executor, Operation* operation, const ExceptionPtr& e, std::size_t count) {
+    
+    PersistentOverlapped* overlapped = static_cast<PersistentOverlapped*>(operation);
+    bool rearmed = overlapped->cb(e, count);
+    executor.endWork();
+    if(!rearmed) executor.destroyOverlapped(overlapped);
     
 }
 #endif
@@ -0,0 +1,540 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/HTTP/HTTPClient.hpp"
+
+#include <cstring>
+
+#include <chrono>
+#include <deque>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util/Byte.hpp"
+#include "Cats/Corecat/Util/Exception.hpp"
+#include "Cats/Netycat/Network/HTTP/HTTPParser.hpp"
+#include "Cats/Netycat/Network/TCP/TCPOption.hpp"
+#include "Cats/Netycat/Network/TCP/TCPSocket.hpp"
+#include "Cats/Netycat/Network/TCP/TCPWriteQueue.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+namespace {
+
+constexpr std::size_t BUFFER_SIZE = 16384;
+
+bool isIdempotent(const std::string& method) noexcept {
+    
+    return method == "GET" || method == "HEAD" || method == "PUT" || method == "DELETE" || method == "OPTIONS" || method == "TRACE";
+    
+}
+
+}
+
+struct HTTPClient::Pending {
+    
+    HTTPRequest request;
+    RequestCallback cb;
+    bool retried = false;
+    
+    Pending(HTTPRequest request_, RequestCallback cb_) : request(std::move(request_)), cb(std::move(cb_)) {}
+    
+};
+
+struct HTTPClient::Host {
+    
+    EndpointType endpoint;
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::deque<Pending> waiting;
+    std::size_t connecting = 0;
+    bool connectFailed = false;
+    
+    Host(const EndpointType& endpoint_) : endpoint(endpoint_) {}
+    
+};
+
+class HTTPClient::Connection {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    using TimePoint = Corecat::HighResolutionClock::time_point;
+    
+private:
+    
+    HTTPClient& client;
+    Host& host;
+    IOExecutor& executor;
+    TCPSocket socket;
+    TCPWriteQueue queue;
+    HTTPParser parser;
+    std::unique_ptr<Byte[]> buffer;
+    std::size_t capacity = BUFFER_SIZE;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    std::deque<Pending> inFlight;
+    std::size_t completed = 0;
+    TimePoint idleSince;
+    bool connecting = false;
+    bool connected = false;
+    bool reading = false;
+    bool closed = false;
+    bool removed = false;
+    bool detached = false;
+    
+private:
+    
+    void read();
+    void process(bool eof);
+    void prepare(ExceptionPtr& e) noexcept;
+    void abort(const ExceptionPtr& e);
+    void release();
+    
+public:
+    
+    Connection(HTTPClient& client_, Host& host_) :
+        client(client_), host(host_), executor(client_.executor), socket(client_.executor), queue(socket), buffer(new Byte[BUFFER_SIZE]) {}
+    
+    void connect();
+    void send(Pending pending);
+    void shutdown();
+    void detach();
+    
+    bool isIdle() const noexcept { return connected && !closed && inFlight.empty(); }
+    bool isReady() const noexcept { return connected && !closed; }
+    std::size_t getLoad() const noexcept { return inFlight.size(); }
+    TimePoint getIdleSince() const noexcept { return idleSince; }
+    
+};
+
+void HTTPClient::Connection::connect() {
+    
+    connecting = true;
+    ++host.connecting;
+    auto self = this;
+    socket.connect(host.endpoint, [=](auto& e) {
+        
+        self->connecting = false;
+        if(self->detached) { self->release(); return; }
+        --self->host.connecting;
+        if(self->closed) { self->release(); return; }
+        if(e) {
+            
+            self->shutdown();
+            if(self->host.connecting) { self->host.connectFailed = true; self->client.dispatch(self->host); return; }
+            self->host.connectFailed = false;
+            bool available = false;
+            for(auto& x : self->host.connections) available = available || x->isReady();
+            if(!available) {
+                
+                auto list = std::move(self->host.waiting);
+                self->host.waiting.clear();
+                HTTPResponse response;
+                for(auto& x : list) x.cb(e, response);
+                
+            } else self->client.dispatch(self->host);
+            return;
+            
+        }
+        ExceptionPtr ignored;
+        self->socket.setOption(TCPOption::noDelay(), ignored);
+        self->connected = true;
+        self->host.connectFailed = false;
+        self->idleSince = Corecat::HighResolutionClock::now();
+        self->queue.setErrorCallback([=](auto& e) { self->abort(e); });
+        self->read();
+        self->client.dispatch(self->host);
+        if(self->isIdle()) self->client.scheduleSweep();
+        
+    });
+    
+}
+void HTTPClient::Connection::send(Pending pending) {
+    
+    std::string head;
+    pending.request.serializeHeader(head);
+    auto& body = pending.request.getBody();
+    if(head.size() + body.size() <= BUFFER_SIZE) {
+        
+        head.append(body);
+        queue.write(head.data(), head.size());
+        
+    } else {
+        
+        queue.write(head.data(), head.size());
+        queue.write(body.data(), body.size());
+        
+    }
+    inFlight.push_back(std::move(pending));
+    
+}
+void HTTPClient::Connection::shutdown() {
+    
+    if(!closed) {
+        
+        closed = true;
+        connected = false;
+        socket.close();
+        
+    }
+    release();
+    
+}
+void HTTPClient::Connection::detach() {
+    
+    detached = true;
+    inFlight.clear();
+    shutdown();
+    
+}
+
+void HTTPClient::Connection::read() {
+    
+    ExceptionPtr e;
+    prepare(e);
+    if(e) { abort(e); return; }
+    reading = true;
+    auto self = this;
+    socket.read(buffer.get() + end, capacity - end, [=](auto& e, auto n) {
+        
+        self->reading = false;
+        if(self->closed) { self->release(); return; }
+        if(e) { self->abort(e); return; }
+        self->end += n;
+        self->process(!n);
+        
+    });
+    
+}
+void HTTPClient::Connection::process(bool eof) {
+    
+    while(!inFlight.empty()) {
+        
+        HTTPResponse response;
+        ExceptionPtr e;
+        auto n = parser.parseResponse(buffer.get() + begin, end - begin, response, inFlight.front().request.isHead(), eof, e);
+        if(e) { abort(e); return; }
+        if(!n) break;
+        begin += n;
+        auto pending = std::move(inFlight.front());
+        inFlight.pop_front();
+        ++completed;
+        if(!pending.request.isKeepAlive() || !response.isKeepAlive()) {
+            
+            shutdown();
+            auto list = std::move(inFlight);
+            inFlight.clear();
+            std::deque<Pending> failed;
+            for(auto p = list.rbegin(); p != list.rend(); ++p) {
+                
+                if(isIdempotent(p->request.getMethod())) host.waiting.push_front(std::move(*p));
+                else failed.push_front(std::move(*p));
+                
+            }
+            pending.cb(ExceptionPtr(), response);
+            HTTPResponse empty;
+            for(auto& x : failed) x.cb(Corecat::IOException("Connection closed"), empty);
+            
+        } else pending.cb(ExceptionPtr(), response);
+        if(closed) { client.dispatch(host); return; }
+        
+    }
+    if(eof || (inFlight.empty() && begin != end)) { abort(Corecat::IOException("Connection closed")); return; }
+    if(inFlight.empty()) {
+        
+        idleSince = Corecat::HighResolutionClock::now();
+        client.scheduleSweep();
+        client.dispatch(host);
+        
+    }
+    if(!closed && !reading) read();
+    
+}
+void HTTPClient::Connection::prepare(ExceptionPtr& e) noexcept {
+    
+    if(begin == end) begin = end = 0;
+    else if(begin && capacity - end < capacity / 2) {
+        
+        std::memmove(buffer.get(), buffer.get() + begin, end - begin);
+        end -= begin, begin = 0;
+        
+    }
+    if(end < capacity) return;
+    std::unique_ptr<Byte[]> newBuffer(new(std::nothrow) Byte[capacity * 2]);
+    if(!newBuffer) { e = Corecat::IOException("HTTP buffer allocation failed"); return; }
+    std::memcpy(newBuffer.get(), buffer.get(), end);
+    buffer = std::move(newBuffer);
+    capacity *= 2;
+    
+}
+void HTTPClient::Connection::abort(const ExceptionPtr& e) {
+    
+    shutdown();
+    if(detached) return;
+    auto list = std::move(inFlight);
+    inFlight.clear();
+    std::deque<Pending> failed;
+    bool partial = begin != end;
+    for(auto p = list.rbegin(); p != list.rend(); ++p) {
+        
+        bool front = p + 1 == list.rend();
+        if(completed && !p->retried && !(front && partial) && isIdempotent(p->request.getMethod())) {
+            
+            p->retried = true;
+            host.waiting.push_front(std::move(*p));
+            
+        } else failed.push_front(std::move(*p));
+        
+    }
+    HTTPResponse response;
+    for(auto& x : failed) x.cb(e, response);
+    client.dispatch(host);
+    
+}
+void HTTPClient::Connection::release() {
+    
+    if(!closed || connecting || reading || queue.getSize() || removed) return;
+    removed = true;
+    auto self = this;
+    executor.execute([=] {
+        
+        if(self->detached) delete self;
+        else self->client.remove(self);
+        
+    });
+    
+}
+
+HTTPClient::HTTPClient(IOExecutor& executor_) : executor(executor_), resolver(executor_), alive(std::make_shared<bool>(true)) {}
+HTTPClient::~HTTPClient() {
+    
+    *alive = false;
+    auto map = std::move(hostMap);
+    hostMap.clear();
+    for(auto& x : map)
+        for(auto& c : x.second->connections) c.release()->detach();
+    
+}
+
+void HTTPClient::dispatch(Host& host) {
+    
+    while(!host.waiting.empty()) {
+        
+        Connection* best = nullptr;
+        for(auto& x : host.connections)
+            if(x->isReady() && x->getLoad() < pipelineDepth && (!best || x->getLoad() < best->getLoad())) best = x.get();
+        if(best && !best->getLoad()) {
+            
+            auto pending = std::move(host.waiting.front());
+            host.waiting.pop_front();
+            best->send(std::move(pending));
+            continue;
+            
+        }
+        if(!host.connectFailed && host.connecting < host.waiting.size() && host.connections.size() < maxConnectionCount) { open(host); continue; }
+        if(host.connecting >= host.waiting.size() || !best) break;
+        auto pending = std::move(host.waiting.front());
+        host.waiting.pop_front();
+        best->send(std::move(pending));
+        
+    }
+    
+}
+void HTTPClient::open(Host& host) {
+    
+    auto connection = new Connection(*this, host);
+    host.connections.emplace_back(connection);
+    connection->connect();
+    
+}
+void HTTPClient::remove(Connection* connection) noexcept {
+    
+    for(auto& x : hostMap) {
+        
+        auto& list = x.second->connections;
+        for(auto p = list.begin(); p != list.end(); ++p) {
+            
+            if(p->get() == connection) {
+                
+                list.erase(p);
+                dispatch(*x.second);
+                return;
+                
+            }
+            
+        }
+        
+    }
+    
+}
+void HTTPClient::scheduleSweep() {
+    
+    if(sweeping) return;
+    bool found = false;
+    Corecat::HighResolutionClock::time_point oldest;
+    for(auto& x : hostMap) {
+        
+        for(auto& c : x.second->connections) {
+            
+            if(c->isIdle() && (!found || c->getIdleSince() < oldest)) {
+                
+                oldest = c->getIdleSince();
+                found = true;
+                
+            }
+            
+        }
+        
+    }
+    if(!found) return;
+    std::chrono::duration<double> time = oldest - Corecat::HighResolutionClock::now();
+    auto delay = time.count() + idleTimeout;
+    sweeping = true;
+    auto self = this;
+    auto alive = this->alive;
+    executor.wait(delay > 0 ? delay : 0, [=]() {
+        
+        if(!*alive) return;
+        self->sweeping = false;
+        self->sweep();
+        
+    });
+    
+}
+void HTTPClient::sweep() {
+    
+    auto now = Corecat::HighResolutionClock::now();
+    for(auto& x : hostMap) {
+        
+        for(auto& c : x.second->connections) {
+            
+            std::chrono::duration<double> time = now - c->getIdleSince();
+            if(c->isIdle() && time.count() >= idleTimeout) c->shutdown();
+            
+        }
+        
+    }
+    scheduleSweep();
+    
+}
+
+void HTTPClient::request(const EndpointType& endpoint, HTTPRequest request, RequestCallback cb) {
+    
+    if(!request.getHeader("Host")) {
+        
+        auto& address = endpoint.getAddress();
+        auto name = address.toString();
+        std::string value(name.getData(), name.getLength());
+        if(address.isIPv6()) value = '[' + value + ']';
+        request.setHeader("Host", value + ':' + std::to_string(endpoint.getPort()));
+        
+    }
+    auto& host = hostMap[endpoint];
+    if(!host) host.reset(new Host(endpoint));
+    host->waiting.emplace_back(std::move(request), std::move(cb));
+    dispatch(*host);
+    
+}
+void HTTPClient::request(const String8& host, std::uint16_t port, HTTPRequest request, RequestCallback cb) {
+    
+    if(!request.getHeader("Host")) {
+        
+        std::string value(host.getData(), host.getLength());
+        if(port != 80) value += ':' + std::to_string(port);
+        request.setHeader("Host", value);
+        
+    }
+    auto self = this;
+    auto alive = this->alive;
+    resolver.resolve(host, [=](auto& e, auto addressList) {
+        
+        if(!*alive) return;
+        if(e) { HTTPResponse response; cb(e, response); return; }
+        self->request(EndpointType(addressList.front(), port), request, cb);
+        
+    });
+    
+}
+Corecat::Promise<HTTPResponse> HTTPClient::requestAsync(const EndpointType& endpoint, HTTPRequest request) {
+    
+    Promise<HTTPResponse> promise;
+    this->request(endpoint, std::move(request), [=](auto& e, auto& response) {
+        e ? promise.reject(e) : promise.resolve(std::move(response));
+    });
+    return promise;
+    
+}
+Corecat::Promise<HTTPResponse> HTTPClient::requestAsync(const String8& host, std::uint16_t port, HTTPRequest request) {
+    
+    Promise<HTTPResponse> promise;
+    this->request(host, port, std::move(request), [=](auto& e, auto& response) {
+        e ? promise.reject(e) : promise.resolve(std::move(response));
+    });
+    return promise;
+    
+}
+
+void HTTPClient::close() noexcept {
+    
+    for(auto& x : hostMap) {
+        
+        auto list = std::move(x.second->waiting);
+        x.second->waiting.clear();
+        HTTPResponse response;
+        for(auto& p : list) p.cb(Corecat::IOException("Client closed"), response);
+        
+    }
+    for(auto& x : hostMap)
+        for(auto& c : x.second->connections) c->shutdown();
+    
+}
+
+std::size_t HTTPClient::getConnectionCount() const noexcept {
+    
+    std::size_t count = 0;
+    for(auto& x : hostMap) count += x.second->connections.size();
+    return count;
+    
+}
+std::size_t HTTPClient::getIdleConnectionCount() const noexcept {
+    
+    std::size_t count = 0;
+    for(auto& x : hostMap)
+        for(auto& c : x.second->connections) count += c->isIdle();
+    return count;
+    
+}
+
+}
+}
+}
+}
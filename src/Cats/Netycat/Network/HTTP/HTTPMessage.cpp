@@ -0,0 +1,125 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/HTTP/HTTPMessage.hpp"
+
+#include <cstring>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+namespace {
+
+char toLower(char c) noexcept { return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c; }
+bool isSpace(char c) noexcept { return c == ' ' || c == '\t'; }
+
+}
+
+const std::string* HTTPMessage::getHeader(const char* name) const noexcept {
+    
+    auto length = std::strlen(name);
+    for(auto& header : headers)
+        if(equalsIgnoreCase(header.first.data(), header.first.size(), name, length)) return &header.second;
+    return nullptr;
+    
+}
+bool HTTPMessage::hasHeaderToken(const char* name, const char* token) const noexcept {
+    
+    auto nameLength = std::strlen(name);
+    auto tokenLength = std::strlen(token);
+    for(auto& header : headers) {
+        
+        if(!equalsIgnoreCase(header.first.data(), header.first.size(), name, nameLength)) continue;
+        auto p = header.second.data(), end = p + header.second.size();
+        while(p != end) {
+            
+            auto q = static_cast<const char*>(std::memchr(p, ',', std::size_t(end - p)));
+            if(!q) q = end;
+            auto b = p, e = q;
+            while(b != e && isSpace(*b)) ++b;
+            while(e != b && isSpace(e[-1])) --e;
+            if(equalsIgnoreCase(b, std::size_t(e - b), token, tokenLength)) return true;
+            p = q == end ? end : q + 1;
+            
+        }
+        
+    }
+    return false;
+    
+}
+void HTTPMessage::setHeader(const char* name, std::string value) {
+    
+    auto length = std::strlen(name);
+    for(auto& header : headers)
+        if(equalsIgnoreCase(header.first.data(), header.first.size(), name, length)) { header.second = std::move(value); return; }
+    headers.emplace_back(std::string(name, length), std::move(value));
+    
+}
+void HTTPMessage::addHeader(std::string name, std::string value) {
+    
+    headers.emplace_back(std::move(name), std::move(value));
+    
+}
+void HTTPMessage::removeHeader(const char* name) noexcept {
+    
+    auto length = std::strlen(name);
+    for(auto it = headers.begin(); it != headers.end(); )
+        if(equalsIgnoreCase(it->first.data(), it->first.size(), name, length)) it = headers.erase(it);
+        else ++it;
+    
+}
+
+bool HTTPMessage::isKeepAlive() const noexcept {
+    
+    if(hasHeaderToken("Connection", "close")) return false;
+    return version >= 11 || hasHeaderToken("Connection", "keep-alive");
+    
+}
+
+void HTTPMessage::clear() noexcept {
+    
+    version = 11;
+    headers.clear();
+    body.clear();
+    
+}
+
+bool HTTPMessage::equalsIgnoreCase(const char* a, std::size_t aLength, const char* b, std::size_t bLength) noexcept {
+    
+    if(aLength != bLength) return false;
+    for(std::size_t i = 0; i < aLength; ++i)
+        if(toLower(a[i]) != toLower(b[i])) return false;
+    return true;
+    
+}
+
+}
+}
+}
+}
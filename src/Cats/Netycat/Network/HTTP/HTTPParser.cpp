@@ -0,0 +1,270 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/HTTP/HTTPParser.hpp"
+
+#include <cstring>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+#include "Cats/Netycat/Network/Impl/Delimiter.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+namespace {
+
+const Corecat::Byte CRLF[] = {'\r', '\n'};
+const Corecat::Byte CRLFCRLF[] = {'\r', '\n', '\r', '\n'};
+
+bool isSpace(Corecat::Byte c) noexcept { return c == ' ' || c == '\t'; }
+bool isToken(Corecat::Byte c) noexcept {
+    
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || (c > 32 && c < 127 && std::strchr("!#$%&'*+-.^_`|~", c));
+    
+}
+
+const Corecat::Byte* findLineEnd(const Corecat::Byte* begin, const Corecat::Byte* end) noexcept {
+    
+    return Impl::findDelimiter(begin, end, CRLF, sizeof(CRLF));
+    
+}
+
+bool parseVersion(const Corecat::Byte* begin, const Corecat::Byte* end, unsigned& version) noexcept {
+    
+    if(end - begin != 8 || std::memcmp(begin, "HTTP/1.", 7)) return false;
+    if(begin[7] == '0') version = 10;
+    else if(begin[7] == '1') version = 11;
+    else return false;
+    return true;
+    
+}
+
+bool parseDecimal(const std::string& s, std::size_t& value) noexcept {
+    
+    if(s.empty() || s.size() > 18) return false;
+    value = 0;
+    for(auto c : s) {
+        
+        if(c < '0' || c > '9') return false;
+        value = value * 10 + std::size_t(c - '0');
+        
+    }
+    return true;
+    
+}
+
+}
+
+std::size_t HTTPParser::findHeaderEnd(const Byte* data, std::size_t size, ExceptionPtr& e) noexcept {
+    
+    auto p = Impl::findDelimiter(data + scanned, data + size, CRLFCRLF, sizeof(CRLFCRLF));
+    if(p == data + size) {
+        
+        scanned = size >= sizeof(CRLFCRLF) ? size - sizeof(CRLFCRLF) + 1 : 0;
+        if(size > maxHeaderSize) headerTooLarge = true, e = Corecat::IOException("Header too large");
+        return 0;
+        
+    }
+    scanned = std::size_t(p - data);
+    auto headerSize = scanned + sizeof(CRLFCRLF);
+    if(headerSize > maxHeaderSize) { headerTooLarge = true, e = Corecat::IOException("Header too large"); return 0; }
+    return headerSize;
+    
+}
+void HTTPParser::parseHeaderList(const Byte* begin, const Byte* end, HTTPMessage& message, ExceptionPtr& e) const {
+    
+    message.clearHeaders();
+    for(auto p = begin; p != end; ) {
+        
+        auto q = findLineEnd(p, end);
+        if(q == end) { e = Corecat::IOException("Invalid header"); return; }
+        auto colon = static_cast<const Byte*>(std::memchr(p, ':', std::size_t(q - p)));
+        if(!colon || colon == p) { e = Corecat::IOException("Invalid header"); return; }
+        for(auto c = p; c != colon; ++c)
+            if(!isToken(*c)) { e = Corecat::IOException("Invalid header"); return; }
+        auto b = colon + 1, t = q;
+        while(b != t && isSpace(*b)) ++b;
+        while(t != b && isSpace(t[-1])) --t;
+        message.addHeader(std::string(reinterpret_cast<const char*>(p), std::size_t(colon - p)), std::string(reinterpret_cast<const char*>(b), std::size_t(t - b)));
+        p = q + sizeof(CRLF);
+        
+    }
+    
+}
+std::size_t HTTPParser::parseBody(const Byte* data, std::size_t size, std::size_t headerSize, HTTPMessage& message, bool untilClose, bool closed, ExceptionPtr& e) {
+    
+    auto& body = message.getBody();
+    body.clear();
+    if(message.isChunked()) {
+        
+        auto n = parseChunked(data + headerSize, size - headerSize, e);
+        if(!n) return 0;
+        body = std::move(chunkBody);
+        return headerSize + n;
+        
+    }
+    if(auto length = message.getHeader("Content-Length")) {
+        
+        std::size_t count;
+        if(!parseDecimal(*length, count)) { e = Corecat::IOException("Invalid Content-Length"); return 0; }
+        if(count > maxBodySize) { e = Corecat::IOException("Body too large"); return 0; }
+        if(size - headerSize < count) return 0;
+        body.assign(reinterpret_cast<const char*>(data + headerSize), count);
+        return headerSize + count;
+        
+    }
+    if(!untilClose) return headerSize;
+    if(size - headerSize > maxBodySize) { e = Corecat::IOException("Body too large"); return 0; }
+    if(!closed) return 0;
+    body.assign(reinterpret_cast<const char*>(data + headerSize), size - headerSize);
+    return size;
+    
+}
+std::size_t HTTPParser::parseChunked(const Byte* data, std::size_t size, ExceptionPtr& e) {
+    
+    auto end = data + size;
+    auto p = data + chunkOffset;
+    while(!chunkTrailer) {
+        
+        auto q = findLineEnd(p, end);
+        if(q == end) {
+            
+            if(std::size_t(end - p) > 1024) e = Corecat::IOException("Invalid chunk");
+            return 0;
+            
+        }
+        std::size_t chunkSize = 0;
+        auto c = p;
+        for(; c != q; ++c) {
+            
+            unsigned digit;
+            if(*c >= '0' && *c <= '9') digit = unsigned(*c - '0');
+            else if(*c >= 'a' && *c <= 'f') digit = unsigned(*c - 'a' + 10);
+            else if(*c >= 'A' && *c <= 'F') digit = unsigned(*c - 'A' + 10);
+            else break;
+            if(chunkSize > (maxBodySize >> 4)) { e = Corecat::IOException("Body too large"); return 0; }
+            chunkSize = chunkSize << 4 | digit;
+            
+        }
+        if(c == p || (c != q && *c != ';' && !isSpace(*c))) { e = Corecat::IOException("Invalid chunk"); return 0; }
+        if(!chunkSize) {
+            
+            p = q + sizeof(CRLF);
+            chunkOffset = std::size_t(p - data);
+            chunkTrailer = true;
+            break;
+            
+        }
+        if(chunkSize > maxBodySize - chunkBody.size()) { e = Corecat::IOException("Body too large"); return 0; }
+        if(std::size_t(end - q) - sizeof(CRLF) < chunkSize + sizeof(CRLF)) return 0;
+        p = q + sizeof(CRLF);
+        if(std::memcmp(p + chunkSize, CRLF, sizeof(CRLF))) { e = Corecat::IOException("Invalid chunk"); return 0; }
+        chunkBody.append(reinterpret_cast<const char*>(p), chunkSize);
+        p += chunkSize + sizeof(CRLF);
+        chunkOffset = std::size_t(p - data);
+        
+    }
+    for(;;) {
+        
+        auto q = findLineEnd(p, end);
+        if(q == end) {
+            
+            if(std::size_t(end - p) > maxHeaderSize) headerTooLarge = true, e = Corecat::IOException("Header too large");
+            return 0;
+            
+        }
+        if(q == p) return std::size_t(q - data) + sizeof(CRLF);
+        p = q + sizeof(CRLF);
+        chunkOffset = std::size_t(p - data);
+        
+    }
+    
+}
+
+std::size_t HTTPParser::parseRequest(const Byte* data, std::size_t size, HTTPRequest& request, ExceptionPtr& e) {
+    
+    auto headerSize = findHeaderEnd(data, size, e);
+    if(!headerSize) return 0;
+    auto headerEnd = data + headerSize - sizeof(CRLF);
+    auto lineEnd = findLineEnd(data, headerEnd);
+    auto methodEnd = static_cast<const Byte*>(std::memchr(data, ' ', std::size_t(lineEnd - data)));
+    if(!methodEnd || methodEnd == data) { e = Corecat::IOException("Invalid request line"); return 0; }
+    auto targetEnd = static_cast<const Byte*>(std::memchr(methodEnd + 1, ' ', std::size_t(lineEnd - methodEnd - 1)));
+    if(!targetEnd || targetEnd == methodEnd + 1) { e = Corecat::IOException("Invalid request line"); return 0; }
+    for(auto c = data; c != methodEnd; ++c)
+        if(!isToken(*c)) { e = Corecat::IOException("Invalid request line"); return 0; }
+    unsigned version;
+    if(!parseVersion(targetEnd + 1, lineEnd, version)) { e = Corecat::IOException("Invalid HTTP version"); return 0; }
+    request.setMethod(std::string(reinterpret_cast<const char*>(data), std::size_t(methodEnd - data)));
+    request.setTarget(std::string(reinterpret_cast<const char*>(methodEnd + 1), std::size_t(targetEnd - methodEnd - 1)));
+    request.setVersion(version);
+    parseHeaderList(lineEnd + sizeof(CRLF), headerEnd, request, e);
+    if(e) return 0;
+    auto n = parseBody(data, size, headerSize, request, false, false, e);
+    if(n) reset();
+    return n;
+    
+}
+std::size_t HTTPParser::parseResponse(const Byte* data, std::size_t size, HTTPResponse& response, bool head, bool closed, ExceptionPtr& e) {
+    
+    auto headerSize = findHeaderEnd(data, size, e);
+    if(!headerSize) return 0;
+    auto headerEnd = data + headerSize - sizeof(CRLF);
+    auto lineEnd = findLineEnd(data, headerEnd);
+    auto versionEnd = static_cast<const Byte*>(std::memchr(data, ' ', std::size_t(lineEnd - data)));
+    unsigned version;
+    if(!versionEnd || !parseVersion(data, versionEnd, version)) { e = Corecat::IOException("Invalid HTTP version"); return 0; }
+    auto p = versionEnd + 1;
+    if(lineEnd - p < 3 || (lineEnd - p > 3 && p[3] != ' ')) { e = Corecat::IOException("Invalid status line"); return 0; }
+    int status = 0;
+    for(int i = 0; i < 3; ++i) {
+        
+        if(p[i] < '0' || p[i] > '9') { e = Corecat::IOException("Invalid status line"); return 0; }
+        status = status * 10 + (p[i] - '0');
+        
+    }
+    response.clear();
+    response.setVersion(version);
+    response.setStatus(status);
+    if(lineEnd - p > 4) response.setReason(std::string(reinterpret_cast<const char*>(p + 4), std::size_t(lineEnd - p - 4)));
+    parseHeaderList(lineEnd + sizeof(CRLF), headerEnd, response, e);
+    if(e) return 0;
+    std::size_t n;
+    if(head || !response.hasBody()) n = headerSize;
+    else n = parseBody(data, size, headerSize, response, true, closed, e);
+    if(n) reset();
+    return n;
+    
+}
+
+}
+}
+}
+}
@@ -0,0 +1,71 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/HTTP/HTTPRequest.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+void HTTPRequest::serializeHeader(std::string& out) const {
+    
+    out += method;
+    out += ' ';
+    out += target;
+    out += version == 10 ? " HTTP/1.0\r\n" : " HTTP/1.1\r\n";
+    for(auto& header : headers) {
+        
+        out += header.first;
+        out += ": ";
+        out += header.second;
+        out += "\r\n";
+        
+    }
+    if(!isChunked() && !getHeader("Content-Length") && (!body.empty() || method == "POST" || method == "PUT")) {
+        
+        out += "Content-Length: ";
+        out += std::to_string(body.size());
+        out += "\r\n";
+        
+    }
+    out += "\r\n";
+    
+}
+
+void HTTPRequest::clear() noexcept {
+    
+    HTTPMessage::clear();
+    method = "GET";
+    target = "/";
+    
+}
+
+}
+}
+}
+}
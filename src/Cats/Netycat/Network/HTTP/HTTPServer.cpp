@@ -0,0 +1,400 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/HTTP/HTTPServer.hpp"
+
+#include <cstring>
+
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Cats/Corecat/Util/Byte.hpp"
+#include "Cats/Corecat/Util/Exception.hpp"
+#include "Cats/Netycat/Network/TCP/TCPOption.hpp"
+#include "Cats/Netycat/Network/TCP/TCPSocket.hpp"
+#include "Cats/Netycat/Network/TCP/TCPWriteQueue.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace HTTP {
+
+namespace {
+
+constexpr std::size_t MAX_TRANSMIT_SIZE = 1073741824;
+
+void appendChunkSize(std::string& out, std::size_t size) {
+    
+    char buffer[sizeof(std::size_t) * 2 + 2];
+    auto p = buffer + sizeof(buffer);
+    *--p = '\n';
+    *--p = '\r';
+    do *--p = "0123456789abcdef"[size & 15]; while(size >>= 4);
+    out.append(p, buffer + sizeof(buffer));
+    
+}
+
+}
+
+class HTTPServer::Connection {
+    
+private:
+    
+    using Byte = Corecat::Byte;
+    
+private:
+    
+    HTTPServer* server;
+    IOExecutor& executor;
+    TCPSocket socket;
+    TCPWriteQueue queue;
+    HTTPParser parser;
+    std::unique_ptr<Byte[]> buffer;
+    std::size_t capacity = DEFAULT_BUFFER_SIZE;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    HTTPRequest request;
+    HTTPResponse response;
+    HTTPResponse transmitResponse;
+    std::string transmitHead;
+    bool reading = false;
+    bool eof = false;
+    bool transmitting = false;
+    bool closing = false;
+    bool closed = false;
+    bool removed = false;
+    
+private:
+    
+    void process();
+    void respond();
+    void respondError(int status);
+    void transmit(std::uint64_t offset);
+    void read();
+    void prepare(ExceptionPtr& e) noexcept;
+    void release();
+    
+public:
+    
+    Connection(HTTPServer& server_, TCPSocket& socket_) :
+        server(&server_), executor(server_.executor), socket(std::move(socket_)), queue(socket),
+        parser(server_.maxHeaderSize, server_.maxBodySize), buffer(new Byte[DEFAULT_BUFFER_SIZE]) {}
+    
+    void start();
+    void shutdown();
+    void detach();
+    
+};
+
+void HTTPServer::Connection::start() {
+    
+    ExceptionPtr e;
+    socket.setOption(TCPOption::noDelay(), e);
+    auto self = this;
+    queue.setWritabilityCallback([=](bool writable) { if(writable) self->process(); });
+    queue.setErrorCallback([=](auto&) { self->shutdown(); });
+    process();
+    
+}
+void HTTPServer::Connection::shutdown() {
+    
+    if(!closed) {
+        
+        closed = true;
+        closing = true;
+        socket.close();
+        
+    }
+    release();
+    
+}
+void HTTPServer::Connection::detach() {
+    
+    server = nullptr;
+    shutdown();
+    
+}
+
+void HTTPServer::Connection::process() {
+    
+    if(closed) return;
+    while(!closing && !transmitting && queue.isWritable()) {
+        
+        ExceptionPtr e;
+        auto n = parser.parseRequest(buffer.get() + begin, end - begin, request, e);
+        if(e) { respondError(parser.isHeaderTooLarge() ? 431 : 400); break; }
+        if(!n) { closing = eof; break; }
+        begin += n;
+        respond();
+        
+    }
+    if(transmitting) return;
+    if(closing) {
+        
+        auto self = this;
+        queue.flush([=](auto&) { self->shutdown(); });
+        return;
+        
+    }
+    if(!reading && !eof && queue.isWritable()) read();
+    
+}
+void HTTPServer::Connection::respond() {
+    
+    response.clear();
+    response.setVersion(request.getVersion());
+    try {
+        
+        server->handler(request, response);
+        
+    } catch(...) {
+        
+        response.clear();
+        response.setVersion(request.getVersion());
+        response.setStatus(500);
+        
+    }
+    if(!server->running || !request.isKeepAlive() || response.hasHeaderToken("Connection", "close")) {
+        
+        response.setHeader("Connection", "close");
+        closing = true;
+        
+    } else if(request.getVersion() == 10) response.setHeader("Connection", "keep-alive");
+    std::string head;
+    response.serializeHeader(head);
+    bool body = response.hasBody() && !request.isHead();
+    if(body && response.getFile()) {
+        
+        transmitHead = std::move(head);
+        transmitResponse = std::move(response);
+        transmitting = true;
+        auto self = this;
+        queue.flush([=](auto& e) {
+            
+            if(e) { self->transmitting = false; self->shutdown(); return; }
+            self->transmit(0);
+            
+        });
+        return;
+        
+    }
+    if(body && response.isChunked()) {
+        
+        auto& data = response.getBody();
+        if(!data.empty()) {
+            
+            appendChunkSize(head, data.size());
+            head.append(data);
+            head.append("\r\n", 2);
+            
+        }
+        head.append("0\r\n\r\n", 5);
+        queue.write(head.data(), head.size());
+        
+    } else if(body && head.size() + response.getBody().size() <= DEFAULT_BUFFER_SIZE) {
+        
+        head.append(response.getBody());
+        queue.write(head.data(), head.size());
+        
+    } else {
+        
+        queue.write(head.data(), head.size());
+        if(body) queue.write(response.getBody().data(), response.getBody().size());
+        
+    }
+    
+}
+void HTTPServer::Connection::respondError(int status) {
+    
+    response.clear();
+    response.setStatus(status);
+    response.setHeader("Connection", "close");
+    std::string head;
+    response.serializeHeader(head);
+    queue.write(head.data(), head.size());
+    closing = true;
+    
+}
+void HTTPServer::Connection::transmit(std::uint64_t offset) {
+    
+    if(closed) { transmitting = false; release(); return; }
+    auto remaining = transmitResponse.getFileSize() - offset;
+    auto count = remaining > MAX_TRANSMIT_SIZE ? MAX_TRANSMIT_SIZE : std::size_t(remaining);
+    auto head = offset ? nullptr : transmitHead.data();
+    auto headSize = offset ? 0 : transmitHead.size();
+    auto self = this;
+    socket.transmitFile(*transmitResponse.getFile(), offset, count, head, headSize, [=](auto& e, auto) {
+        
+        if(e) { self->transmitting = false; self->shutdown(); return; }
+        if(offset + count < self->transmitResponse.getFileSize()) { self->transmit(offset + count); return; }
+        self->transmitting = false;
+        self->transmitResponse.clear();
+        self->transmitHead.clear();
+        self->process();
+        
+    });
+    
+}
+void HTTPServer::Connection::read() {
+    
+    ExceptionPtr e;
+    prepare(e);
+    if(e) { respondError(413); process(); return; }
+    reading = true;
+    auto self = this;
+    socket.read(buffer.get() + end, capacity - end, [=](auto& e, auto n) {
+        
+        self->reading = false;
+        if(e || self->closed) { self->shutdown(); return; }
+        if(!n) self->eof = true;
+        self->end += n;
+        self->process();
+        
+    });
+    
+}
+void HTTPServer::Connection::prepare(ExceptionPtr& e) noexcept {
+    
+    if(begin == end) begin = end = 0;
+    else if(begin && capacity - end < capacity / 2) {
+        
+        std::memmove(buffer.get(), buffer.get() + begin, end - begin);
+        end -= begin, begin = 0;
+        
+    }
+    if(end < capacity) return;
+    std::unique_ptr<Byte[]> newBuffer(new(std::nothrow) Byte[capacity * 2]);
+    if(!newBuffer) { e = Corecat::IOException("HTTP buffer allocation failed"); return; }
+    std::memcpy(newBuffer.get(), buffer.get(), end);
+    buffer = std::move(newBuffer);
+    capacity *= 2;
+    
+}
+void HTTPServer::Connection::release() {
+    
+    if(!closed || reading || transmitting || queue.getSize() || removed) return;
+    removed = true;
+    auto self = this;
+    executor.execute([=] {
+        
+        if(self->server) self->server->remove(self);
+        else delete self;
+        
+    });
+    
+}
+
+HTTPServer::HTTPServer(IOExecutor& executor_, Handler handler_) :
+    executor(executor_), handler(std::move(handler_)), server(executor_) {}
+HTTPServer::~HTTPServer() {
+    
+    running = false;
+    server.close();
+    auto map = std::move(connectionMap);
+    connectionMap.clear();
+    for(auto& x : map) x.second.release()->detach();
+    
+}
+
+void HTTPServer::start() {
+    
+    running = true;
+    auto self = this;
+    server.acceptLoop([=](auto& e, auto& socket) {
+        
+        if(e || !self->running) return;
+        auto connection = new Connection(*self, socket);
+        self->connectionMap.emplace(connection, std::unique_ptr<Connection>(connection));
+        connection->start();
+        
+    });
+    
+}
+void HTTPServer::remove(Connection* connection) noexcept {
+    
+    connectionMap.erase(connection);
+    
+}
+
+void HTTPServer::listen(std::uint16_t port) {
+    
+    ExceptionPtr e;
+    listen(port, e);
+    if(e) e.rethrow();
+    
+}
+void HTTPServer::listen(const IPAddress& address, std::uint16_t port) {
+    
+    ExceptionPtr e;
+    listen(address, port, e);
+    if(e) e.rethrow();
+    
+}
+void HTTPServer::listen(const EndpointType& endpoint) {
+    
+    ExceptionPtr e;
+    listen(endpoint, e);
+    if(e) e.rethrow();
+    
+}
+void HTTPServer::listen(std::uint16_t port, ExceptionPtr& e) noexcept {
+    
+    server.listen(port, e);
+    if(e) return;
+    start();
+    
+}
+void HTTPServer::listen(const IPAddress& address, std::uint16_t port, ExceptionPtr& e) noexcept {
+    
+    server.listen(address, port, e);
+    if(e) return;
+    start();
+    
+}
+void HTTPServer::listen(const EndpointType& endpoint, ExceptionPtr& e) noexcept {
+    
+    server.listen(endpoint, e);
+    if(e) return;
+    start();
+    
+}
+
+void HTTPServer::close() noexcept {
+    
+    running = false;
+    server.close();
+    std::vector<Connection*> list;
+    for(auto& x : connectionMap) list.push_back(x.first);
+    for(auto connection : list) connection->shutdown();
+    
+}
+
+}
+}
+}
+}
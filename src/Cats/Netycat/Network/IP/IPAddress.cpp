@@ -0,0 +1,356 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/IP/IPAddress.hpp"
+
+#include "Cats/Netycat/Impl/SIMD.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace IP {
+
+namespace {
+
+inline unsigned getHexValue(char c) noexcept {
+    
+    if(c >= '0' && c <= '9') return unsigned(c - '0');
+    if(c >= 'a' && c <= 'f') return unsigned(c - 'a' + 10);
+    if(c >= 'A' && c <= 'F') return unsigned(c - 'A' + 10);
+    return 16;
+    
+}
+
+bool parseIPv4Scalar(const char* p, const char* e, std::uint8_t* data) noexcept {
+    
+    for(std::size_t i = 0; i < 4; ++i) {
+        
+        unsigned value = 0, count = 0;
+        for(; p != e && *p >= '0' && *p <= '9'; ++p, ++count) {
+            
+            if(count == 3 || (count && !value)) return false;
+            value = value * 10 + unsigned(*p - '0');
+            
+        }
+        if(!count || value > 255) return false;
+        data[i] = std::uint8_t(value);
+        if(i == 3) return p == e;
+        if(p == e || *p != '.') return false;
+        ++p;
+        
+    }
+    return false;
+    
+}
+
+#if defined(NETYCAT_SIMD_SSE2)
+bool parseIPv4SSE2(const char* str, std::size_t length, std::uint8_t* data) noexcept {
+    
+    alignas(16) std::uint8_t buffer[16] = {};
+    std::memcpy(buffer, str, length);
+    auto x = _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+    auto d = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+    std::uint32_t valid = (std::uint32_t(1) << length) - 1;
+    std::uint32_t dots = std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('.')))) & valid;
+    std::uint32_t digits = std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d))) & valid;
+    if((dots | digits) != valid) return false;
+    _mm_store_si128(reinterpret_cast<__m128i*>(buffer), d);
+    
+    unsigned begin = 0;
+    for(std::size_t i = 0; i < 4; ++i) {
+        
+        unsigned end = unsigned(length);
+        if(i < 3) {
+            
+            if(!dots) return false;
+            end = SIMD::countTrailingZero(dots);
+            dots &= dots - 1;
+            
+        }
+        unsigned value;
+        switch(end - begin) {
+        case 1: value = buffer[begin]; break;
+        case 2: value = buffer[begin] * 10u + buffer[begin + 1]; break;
+        case 3: value = buffer[begin] * 100u + buffer[begin + 1] * 10u + buffer[begin + 2]; break;
+        default: return false;
+        }
+        if((end - begin > 1 && !buffer[begin]) || value > 255) return false;
+        data[i] = std::uint8_t(value);
+        begin = end + 1;
+        
+    }
+    return !dots;
+    
+}
+#endif
+
+struct DecimalTable {
+    
+    char data[256][4];
+    
+    DecimalTable() noexcept {
+        
+        for(unsigned i = 0; i < 256; ++i) {
+            
+            if(i >= 100) data[i][0] = 3, data[i][1] = char('0' + i / 100), data[i][2] = char('0' + i / 10 % 10), data[i][3] = char('0' + i % 10);
+            else if(i >= 10) data[i][0] = 2, data[i][1] = char('0' + i / 10), data[i][2] = char('0' + i % 10);
+            else data[i][0] = 1, data[i][1] = char('0' + i);
+            
+        }
+        
+    }
+    
+};
+const DecimalTable DECIMAL_TABLE;
+const char HEX_DIGIT[] = "0123456789abcdef";
+
+inline char* formatDecimal(char* p, std::uint8_t x) noexcept {
+    
+    auto& entry = DECIMAL_TABLE.data[x];
+    std::memcpy(p, entry + 1, 3);
+    return p + entry[0];
+    
+}
+
+inline char* formatIPv4(char* p, const std::uint8_t* data) noexcept {
+    
+    p = formatDecimal(p, data[0]), *p++ = '.';
+    p = formatDecimal(p, data[1]), *p++ = '.';
+    p = formatDecimal(p, data[2]), *p++ = '.';
+    return formatDecimal(p, data[3]);
+    
+}
+
+inline char* formatHex(char* p, unsigned x) noexcept {
+    
+    if(x >= 0x1000) *p++ = HEX_DIGIT[x >> 12];
+    if(x >= 0x100) *p++ = HEX_DIGIT[(x >> 8) & 0xF];
+    if(x >= 0x10) *p++ = HEX_DIGIT[(x >> 4) & 0xF];
+    *p++ = HEX_DIGIT[x & 0xF];
+    return p;
+    
+}
+
+bool parseScope(const char* p, const char* e, std::uint32_t& scope) noexcept {
+    
+    if(p == e) return false;
+    std::uint64_t value = 0;
+    for(; p != e; ++p) {
+        
+        if(*p < '0' || *p > '9') return false;
+        if((value = value * 10 + unsigned(*p - '0')) > 0xFFFFFFFF) return false;
+        
+    }
+    scope = std::uint32_t(value);
+    return true;
+    
+}
+
+}
+
+bool IPv4Address::tryParse(const char* str, std::size_t length, IPv4Address& address) noexcept {
+    
+    if(length < 7 || length > 15) return false;
+#if defined(NETYCAT_SIMD_SSE2)
+    return parseIPv4SSE2(str, length, address.data);
+#else
+    return parseIPv4Scalar(str, str + length, address.data);
+#endif
+    
+}
+
+std::size_t IPv4Address::formatTo(char* str) const noexcept {
+    
+    return std::size_t(formatIPv4(str, data) - str);
+    
+}
+
+std::size_t IPv6Address::formatTo(char* str) const noexcept {
+    
+    unsigned group[8];
+    for(std::size_t i = 0; i < 8; ++i) group[i] = (unsigned(data[i * 2]) << 8) | data[i * 2 + 1];
+    
+    std::size_t gapBegin = 8, gapLength = 1;
+    for(std::size_t i = 0; i < 8; ) {
+        
+        if(group[i]) { ++i; continue; }
+        std::size_t j = i + 1;
+        while(j < 8 && !group[j]) ++j;
+        if(j - i > gapLength) gapBegin = i, gapLength = j - i;
+        i = j;
+        
+    }
+    
+    auto p = str;
+    if(gapBegin == 0 && (gapLength == 6 || (gapLength == 5 && group[5] == 0xFFFF))) {
+        
+        std::memcpy(p, gapLength == 6 ? "::" : "::ffff:", gapLength == 6 ? 2 : 7);
+        p += gapLength == 6 ? 2 : 7;
+        p = formatIPv4(p, data + 12);
+        
+    } else {
+        
+        for(std::size_t i = 0; i < 8; ) {
+            
+            if(i == gapBegin) {
+                
+                *p++ = ':', *p++ = ':';
+                i += gapLength;
+                continue;
+                
+            }
+            if(i && i != gapBegin + gapLength) *p++ = ':';
+            p = formatHex(p, group[i++]);
+            
+        }
+        
+    }
+    if(scope) {
+        
+        char buffer[10];
+        auto q = buffer + 10;
+        for(auto x = scope; x; x /= 10) *--q = char('0' + x % 10);
+        *p++ = '%';
+        std::memcpy(p, q, std::size_t(buffer + 10 - q));
+        p += buffer + 10 - q;
+        
+    }
+    return std::size_t(p - str);
+    
+}
+
+bool IPv6Address::tryParse(const char* str, std::size_t length, IPv6Address& address) noexcept {
+    
+    auto p = str, e = str + length;
+    std::uint32_t scope = 0;
+    if(auto q = static_cast<const char*>(std::memchr(str, '%', length))) {
+        
+        if(!parseScope(q + 1, e, scope)) return false;
+        e = q;
+        
+    }
+    if(e - p < 2) return false;
+    
+    std::uint8_t data[16];
+    std::size_t count = 0, gap = 0;
+    bool compressed = false;
+    if(p[0] == ':') {
+        
+        if(p[1] != ':') return false;
+        compressed = true, p += 2;
+        
+    }
+    while(p != e) {
+        
+        auto q = p;
+        unsigned value = 0, h;
+        while(q != e && q - p < 5 && (h = getHexValue(*q)) < 16) value = (value << 4) | h, ++q;
+        if(q != e && *q == '.') {
+            
+            if(count > 12 || !parseIPv4Scalar(p, e, data + count)) return false;
+            count += 4;
+            break;
+            
+        }
+        if(q == p || q - p > 4 || count == 16) return false;
+        data[count++] = std::uint8_t(value >> 8);
+        data[count++] = std::uint8_t(value);
+        if(q == e) break;
+        if(*q != ':' || ++q == e) return false;
+        if(*q == ':') {
+            
+            if(compressed) return false;
+            compressed = true, gap = count, ++q;
+            
+        }
+        p = q;
+        
+    }
+    
+    if(!compressed) {
+        
+        if(count != 16) return false;
+        
+    } else {
+        
+        if(count == 16) return false;
+        std::size_t n = count - gap;
+        std::memmove(data + 16 - n, data + gap, n);
+        std::memset(data + gap, 0, 16 - count);
+        
+    }
+    address.setData(data);
+    address.scope = scope;
+    return true;
+    
+}
+
+bool IPAddress::tryParse(const char* str, std::size_t length, IPAddress& address) noexcept {
+    
+    if(std::memchr(str, ':', length)) {
+        
+        IPv6Address v6;
+        if(!IPv6Address::tryParse(str, length, v6)) return false;
+        address = v6;
+        
+    } else {
+        
+        IPv4Address v4;
+        if(!IPv4Address::tryParse(str, length, v4)) return false;
+        address = v4;
+        
+    }
+    return true;
+    
+}
+
+std::size_t IPAddress::parseMany(const char* str, std::size_t length, std::vector<IPAddress>& addresses) {
+    
+    std::size_t invalid = 0;
+    for(auto p = str, e = str + length; p != e; ) {
+        
+        auto q = static_cast<const char*>(std::memchr(p, '\n', std::size_t(e - p)));
+        auto end = q ? q : e;
+        if(end != p && end[-1] == '\r') --end;
+        if(end != p) {
+            
+            IPAddress address;
+            if(tryParse(p, std::size_t(end - p), address)) addresses.push_back(address);
+            else ++invalid;
+            
+        }
+        p = q ? q + 1 : e;
+        
+    }
+    return invalid;
+    
+}
+
+}
+}
+}
+}
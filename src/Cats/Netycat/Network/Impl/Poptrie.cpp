@@ -0,0 +1,149 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/Impl/Poptrie.hpp"
+
+#include <algorithm>
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+namespace Impl {
+
+namespace {
+
+bool isEntryLess(const Poptrie::Entry& a, const Poptrie::Entry& b) noexcept {
+    
+    if(a.high != b.high) return a.high < b.high;
+    if(a.low != b.low) return a.low < b.low;
+    return a.length < b.length;
+    
+}
+
+}
+
+Poptrie::Poptrie() : direct(std::size_t(1) << DIRECT_BITS, NONE | LEAF) {}
+
+void Poptrie::buildNode(std::uint32_t index, const Entry* begin, const Entry* end, std::size_t offset, std::uint32_t value) {
+    
+    std::uint32_t slot[64];
+    std::fill(slot, slot + 64, value);
+    std::uint64_t vector = 0;
+    std::vector<const Entry*> fill;
+    for(auto p = begin; p != end; ++p) {
+        
+        if(p->length <= offset) continue;
+        auto v = extract(p->high, p->low, offset);
+        if(p->length <= offset + STRIDE) fill.push_back(p);
+        else vector |= std::uint64_t(1) << v;
+        
+    }
+    std::stable_sort(fill.begin(), fill.end(), [](auto a, auto b) { return a->length < b->length; });
+    for(auto p : fill) {
+        
+        std::size_t span = std::size_t(1) << (offset + STRIDE - p->length);
+        auto v = extract(p->high, p->low, offset) & ~unsigned(span - 1);
+        std::fill(slot + v, slot + v + span, p->value);
+        
+    }
+    
+    std::uint64_t leafvec = 0;
+    auto base0 = std::uint32_t(leaves.size());
+    for(unsigned v = 0; v < 64; ++v) {
+        
+        if((vector >> v) & 1) continue;
+        if(leaves.size() == base0 || leaves.back() != slot[v]) leafvec |= std::uint64_t(1) << v, leaves.push_back(slot[v]);
+        
+    }
+    
+    auto base1 = std::uint32_t(nodes.size());
+    nodes.resize(nodes.size() + SIMD::countPopulation(vector));
+    nodes[index] = {vector, leafvec, base0, base1};
+    auto p = begin;
+    for(unsigned v = 0, k = 0; v < 64; ++v) {
+        
+        if(!((vector >> v) & 1)) continue;
+        while(extract(p->high, p->low, offset) < v) ++p;
+        auto q = p;
+        while(q != end && extract(q->high, q->low, offset) == v) ++q;
+        buildNode(base1 + k++, p, q, offset + STRIDE, slot[v]);
+        p = q;
+        
+    }
+    
+}
+
+void Poptrie::build(std::vector<Entry> entries) {
+    
+    if(!std::is_sorted(entries.begin(), entries.end(), isEntryLess))
+        std::stable_sort(entries.begin(), entries.end(), isEntryLess);
+    
+    std::vector<std::uint32_t> slot(std::size_t(1) << DIRECT_BITS, NONE);
+    std::vector<bool> child(std::size_t(1) << DIRECT_BITS);
+    std::vector<const Entry*> fill;
+    for(auto&& x : entries) {
+        
+        if(x.length <= DIRECT_BITS) fill.push_back(&x);
+        else child[std::size_t(x.high >> (64 - DIRECT_BITS))] = true;
+        
+    }
+    std::stable_sort(fill.begin(), fill.end(), [](auto a, auto b) { return a->length < b->length; });
+    for(auto p : fill) {
+        
+        std::size_t span = std::size_t(1) << (DIRECT_BITS - p->length);
+        auto v = std::size_t(p->high >> (64 - DIRECT_BITS)) & ~(span - 1);
+        std::fill(slot.begin() + v, slot.begin() + v + span, p->value);
+        
+    }
+    
+    nodes.clear();
+    leaves.clear();
+    auto p = entries.data(), end = entries.data() + entries.size();
+    for(std::size_t v = 0; v < direct.size(); ++v) {
+        
+        auto q = p;
+        while(q != end && std::size_t(q->high >> (64 - DIRECT_BITS)) == v) ++q;
+        if(child[v]) {
+            
+            auto index = std::uint32_t(nodes.size());
+            nodes.emplace_back();
+            buildNode(index, p, q, DIRECT_BITS, slot[v]);
+            direct[v] = index;
+            
+        } else direct[v] = slot[v] | LEAF;
+        p = q;
+        
+    }
+    nodes.shrink_to_fit();
+    leaves.shrink_to_fit();
+    
+}
+
+}
+}
+}
+}
@@ -26,12 +26,62 @@
 
 #include "Cats/Netycat/Network/Impl/Socket.hpp"
 
+#include <memory>
+#include <new>
+
 
 namespace Cats {
 namespace Netycat {
 inline namespace Network {
 namespace Impl {
 
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+namespace {
+
+struct AcceptSlot {
+    
+    IOExecutor::PersistentOverlapped* overlapped = nullptr;
+    IOExecutor::PersistentOverlapped* forward = nullptr;
+    SOCKET handle = INVALID_SOCKET;
+    Corecat::ExceptionPtr e;
+    Corecat::Byte buffer[Socket::ACCEPT_BUFFER_SIZE];
+    
+};
+
+class GatherBuffer {
+    
+private:
+    
+    static constexpr std::size_t LOCAL_COUNT = 16;
+    
+private:
+    
+    WSABUF local[LOCAL_COUNT];
+    std::unique_ptr<WSABUF[]> heap;
+    WSABUF* data;
+    DWORD count;
+    
+public:
+    
+    GatherBuffer(const IOBuffer& buffer) : count(DWORD(buffer.getSegmentCount())) {
+        
+        if(count <= LOCAL_COUNT) data = local;
+        else heap.reset(data = new(std::nothrow) WSABUF[count]);
+        if(!data) { count = 0; return; }
+        for(DWORD i = 0; i < count; ++i)
+            data[i] = {u_long(buffer.getSegmentSize(i)), reinterpret_cast<char*>(const_cast<Corecat::Byte*>(buffer.getSegmentData(i)))};
+        
+    }
+    
+    bool isValid() const noexcept { return data; }
+    WSABUF* getData() noexcept { return data; }
+    DWORD getCount() const noexcept { return count; }
+    
+};
+
+}
+#endif
+
 Socket::Socket() {
     
     WSA::init();
@@ -44,14 +94,42 @@ Socket::Socket(IOExecutor& executor_) : executor(&executor_) {
 }
 Socket::Socket(NativeHandleType handle_) { setHandle(handle_); }
 Socket::Socket(IOExecutor& executor_, NativeHandleType handle_) : executor(&executor_) { setHandle(handle_); }
+Socket::Socket(Socket&& src) noexcept : executor(src.executor), handle(src.handle) {
+    
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    family = src.family, type = src.type, protocol = src.protocol;
+    src.family = 0, src.type = 0, src.protocol = 0;
+    acceptStopped = std::move(src.acceptStopped);
+#endif
+    src.handle = 0;
+    
+}
 Socket::~Socket() {
     
     if(handle) close();
     
 }
 
+Socket& Socket::operator =(Socket&& src) noexcept {
+    
+    if(this == &src) return *this;
+    if(handle) close();
+    executor = src.executor, handle = src.handle;
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    family = src.family, type = src.type, protocol = src.protocol;
+    src.family = 0, src.type = 0, src.protocol = 0;
+    acceptStopped = std::move(src.acceptStopped);
+#endif
+    src.handle = 0;
+    return *this;
+    
+}
+
 void Socket::close() noexcept {
     
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    if(acceptStopped) *acceptStopped = true, acceptStopped = nullptr;
+#endif
     ::closesocket(handle);
     handle = 0;
 #if defined(NETYCAT_IOEXECUTOR_IOCP)
@@ -143,12 +221,18 @@ void Socket::accept(Socket& s, AcceptCallback cb) noexcept {
     SOCKET h = ::socket(family, type, protocol);
     if(h == INVALID_SOCKET)
         { cb(Corecat::IOException("::socket failed")); return; }
-    auto buffer = new Corecat::Byte[(sizeof(sockaddr_storage) + 16) * 2];
+    auto buffer = new Corecat::Byte[ACCEPT_BUFFER_SIZE];
+    auto listener = handle;
     auto overlapped = executor->createOverlapped([=, &s](auto& e, auto) {
         
         delete[] buffer;
         if(e) ::closesocket(h);
-        else s.setHandle(h);
+        else {
+            
+            ::setsockopt(h, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, reinterpret_cast<const char*>(&listener), sizeof(listener));
+            s.setHandle(h);
+            
+        }
         cb(e);
         
     });
@@ -158,13 +242,119 @@ void Socket::accept(Socket& s, AcceptCallback cb) noexcept {
         delete[] buffer;
         executor->destroyOverlapped(overlapped);
         ::closesocket(h);
-        cb(Corecat::IOException("::AccpetEx failed"));
+        cb(Corecat::IOException("::AcceptEx failed"));
         return;
         
     }
 #endif
 }
 
+void Socket::acceptLoop(std::size_t count, AcceptLoopCallback cb) noexcept {
+    
+    acceptLoop(count, *executor, std::move(cb));
+    
+}
+void Socket::acceptLoop(std::size_t count, IOExecutor& target, AcceptLoopCallback cb) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    if(!family && !type && !protocol) {
+        
+        ExceptionPtr e;
+        getSocketInfo(e);
+        if(e) { cb(e, 0); return; }
+        
+    }
+    if(!acceptStopped) acceptStopped = std::make_shared<std::atomic<bool>>(false);
+    auto stopped = acceptStopped;
+    auto f = std::make_shared<AcceptLoopCallback>(std::move(cb));
+    auto executor = this->executor;
+    auto shard = &target;
+    auto listener = handle;
+    auto family = this->family, type = this->type, protocol = this->protocol;
+    auto post = [=](AcceptSlot& slot) {
+        
+        if((slot.handle = ::socket(family, type, protocol)) == INVALID_SOCKET)
+            { (*f)(Corecat::IOException("::socket failed"), 0); return false; }
+        executor->resetOverlapped(slot.overlapped);
+        if(!WSA::AcceptEx(listener, slot.handle, slot.buffer, 0, sizeof(sockaddr_storage) + 16, sizeof(sockaddr_storage) + 16, nullptr, slot.overlapped)
+            && ::WSAGetLastError() != ERROR_IO_PENDING) {
+            
+            executor->endWork();
+            ::closesocket(slot.handle);
+            slot.handle = INVALID_SOCKET;
+            (*f)(Corecat::IOException("::AcceptEx failed"), 0);
+            return false;
+            
+        }
+        return true;
+        
+    };
+    auto complete = [=](AcceptSlot& slot) {
+        
+        auto h = slot.handle;
+        auto e = std::move(slot.e);
+        slot.handle = INVALID_SOCKET;
+        if(*stopped) { ::closesocket(h); return false; }
+        if(e) {
+            
+            ::closesocket(h);
+            (*f)(e, 0);
+            
+        } else {
+            
+            ::setsockopt(h, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, reinterpret_cast<const char*>(&listener), sizeof(listener));
+            (*f)(e, h);
+            
+        }
+        return !*stopped && post(slot);
+        
+    };
+    for(std::size_t i = 0; i < count; ++i) {
+        
+        auto slot = std::make_shared<AcceptSlot>();
+        if(shard == executor) {
+            
+            slot->overlapped = executor->createPersistentOverlapped([=](auto& e, auto) {
+                
+                slot->e = e;
+                return complete(*slot);
+                
+            });
+            if(!post(*slot)) { executor->destroyOverlapped(slot->overlapped); return; }
+            
+        } else {
+            
+            slot->overlapped = executor->createPersistentOverlapped([=](auto& e, auto) {
+                
+                slot->e = e;
+                shard->resetOverlapped(slot->forward);
+                shard->post(slot->forward);
+                return true;
+                
+            });
+            slot->forward = shard->createPersistentOverlapped([=](auto&, auto) {
+                
+                if(complete(*slot)) return true;
+                executor->destroyOverlapped(slot->overlapped);
+                shard->endWork();
+                return false;
+                
+            });
+            shard->beginWork();
+            if(!post(*slot)) {
+                
+                shard->endWork();
+                executor->destroyOverlapped(slot->overlapped);
+                shard->destroyOverlapped(slot->forward);
+                return;
+                
+            }
+            
+        }
+        
+    }
+#endif
+}
+
 std::size_t Socket::read(void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
     
     // TODO: The "count" argument is int on Windows, but size_t on Linux
@@ -190,6 +380,56 @@ void Socket::read(void* buffer, std::size_t count, ReadCallback cb) noexcept {
 #endif
 }
 
+std::size_t Socket::read(IOBuffer& buffer, std::size_t count, ExceptionPtr& e) noexcept {
+    
+    Byte* data;
+    try { data = buffer.reserve(count); }
+    catch(std::bad_alloc&) { e = Corecat::IOException("Buffer allocation failed"); return 0; }
+    auto ret = read(data, count, e);
+    buffer.commit(ret);
+    return ret;
+    
+}
+void Socket::read(IOBuffer& buffer, std::size_t count, ReadCallback cb) noexcept {
+    
+    auto p = &buffer;
+    Byte* data;
+    try { data = p->reserve(count); }
+    catch(std::bad_alloc&) { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    read(data, count, [=, cb = std::move(cb)](auto& e, auto count) {
+        
+        if(!e) p->commit(count);
+        cb(e, count);
+        
+    });
+    
+}
+void Socket::readPooled(ReadPooledCallback cb) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    auto self = this;
+    auto overlapped = executor->createOverlapped([=](auto& e, auto) {
+        
+        if(e) { IOBuffer buffer; cb(e, buffer); return; }
+        std::shared_ptr<IOBuffer> buffer;
+        try { buffer = std::make_shared<IOBuffer>(self->executor->getBufferPool().acquire()); }
+        catch(...) { IOBuffer empty; cb(Corecat::IOException("Buffer allocation failed"), empty); return; }
+        self->read(*buffer, buffer->getTailroom(), [=](auto& e, auto) { cb(e, *buffer); });
+        
+    });
+    WSABUF buf = {0, nullptr};
+    DWORD flags = 0;
+    if(::WSARecv(handle, &buf, 1, nullptr, &flags, overlapped, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING) {
+        
+        executor->destroyOverlapped(overlapped);
+        IOBuffer buffer;
+        cb(Corecat::IOException("::WSARecv failed"), buffer);
+        return;
+        
+    }
+#endif
+}
+
 std::size_t Socket::readAll(void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
     
     auto p = static_cast<Byte*>(buffer);
@@ -197,6 +437,7 @@ std::size_t Socket::readAll(void* buffer, std::size_t count, ExceptionPtr& e) no
         
         std::size_t ret = read(p, n, e);
         if(e) return 0;
+        if(!ret) { e = Corecat::IOException("Connection closed"); return 0; }
         p += ret, n -= ret;
         
     }
@@ -209,6 +450,7 @@ void Socket::readAllImpl(Byte* buffer, std::size_t n, ReadCallback cb, std::size
     read(buffer, n, [=](auto& e, auto c) {
         
         if(e || n == c) cb(e, count);
+        else if(!c) cb(Corecat::IOException("Connection closed"), 0);
         else self->readAllImpl(buffer + c, n - c, cb, count);
         
     });
@@ -244,6 +486,31 @@ void Socket::readFrom(void* buffer, std::size_t count, void* address, socklen_t&
 #endif
 }
 
+std::size_t Socket::readFrom(IOBuffer& buffer, std::size_t count, void* address, socklen_t& size, ExceptionPtr& e) noexcept {
+    
+    Byte* data;
+    try { data = buffer.reserve(count); }
+    catch(std::bad_alloc&) { e = Corecat::IOException("Buffer allocation failed"); return 0; }
+    auto ret = readFrom(data, count, address, size, e);
+    buffer.commit(ret);
+    return ret;
+    
+}
+void Socket::readFrom(IOBuffer& buffer, std::size_t count, void* address, socklen_t& size, ReadCallback cb) noexcept {
+    
+    auto p = &buffer;
+    Byte* data;
+    try { data = p->reserve(count); }
+    catch(std::bad_alloc&) { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    readFrom(data, count, address, size, [=, cb = std::move(cb)](auto& e, auto count) {
+        
+        if(!e) p->commit(count);
+        cb(e, count);
+        
+    });
+    
+}
+
 std::size_t Socket::write(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
     
     std::ptrdiff_t ret = ::send(handle, static_cast<const char*>(buffer), int(count), 0);
@@ -267,6 +534,45 @@ void Socket::write(const void* buffer, std::size_t count, WriteCallback cb) noex
 #endif
 }
 
+std::size_t Socket::write(const IOBuffer& buffer, ExceptionPtr& e) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    GatherBuffer buf(buffer);
+    if(!buf.isValid())
+        { e = Corecat::IOException("Buffer allocation failed"); return 0; }
+    DWORD ret = 0;
+    if(::WSASend(handle, buf.getData(), buf.getCount(), &ret, 0, nullptr, nullptr))
+        { e = Corecat::IOException("::WSASend failed"); return 0; }
+    return ret;
+#endif
+}
+void Socket::write(const IOBuffer& buffer, WriteCallback cb) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    GatherBuffer buf(buffer);
+    if(!buf.isValid())
+        { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    IOExecutor::Overlapped* overlapped;
+    try {
+        
+        auto retained = std::make_shared<IOBuffer>(buffer.clone());
+        overlapped = executor->createOverlapped([=, retained = std::move(retained)](auto& e, auto count) {
+            
+            retained->clear();
+            cb(e, count);
+            
+        });
+        
+    } catch(std::bad_alloc&) { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    if(::WSASend(handle, buf.getData(), buf.getCount(), nullptr, 0, overlapped, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING) {
+        
+        executor->destroyOverlapped(overlapped);
+        cb(Corecat::IOException("::WSASend failed"), 0);
+        return;
+        
+    }
+#endif
+}
+
 std::size_t Socket::writeAll(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
     
     auto p = static_cast<const Byte*>(buffer);
@@ -320,6 +626,171 @@ void Socket::writeTo(const void* buffer, std::size_t count, const void* address,
 #endif
 }
 
+std::size_t Socket::writeTo(const IOBuffer& buffer, const void* address, socklen_t size, ExceptionPtr& e) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    GatherBuffer buf(buffer);
+    if(!buf.isValid())
+        { e = Corecat::IOException("Buffer allocation failed"); return 0; }
+    DWORD ret = 0;
+    if(::WSASendTo(handle, buf.getData(), buf.getCount(), &ret, 0, reinterpret_cast<const sockaddr*>(address), size, nullptr, nullptr))
+        { e = Corecat::IOException("::WSASendTo failed"); return 0; }
+    return ret;
+#endif
+}
+void Socket::writeTo(const IOBuffer& buffer, const void* address, socklen_t size, WriteCallback cb) noexcept {
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+    GatherBuffer buf(buffer);
+    if(!buf.isValid())
+        { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    IOExecutor::Overlapped* overlapped;
+    try {
+        
+        auto retained = std::make_shared<IOBuffer>(buffer.clone());
+        overlapped = executor->createOverlapped([=, retained = std::move(retained)](auto& e, auto count) {
+            
+            retained->clear();
+            cb(e, count);
+            
+        });
+        
+    } catch(std::bad_alloc&) { cb(Corecat::IOException("Buffer allocation failed"), 0); return; }
+    if(::WSASendTo(handle, buf.getData(), buf.getCount(), nullptr, 0, reinterpret_cast<const sockaddr*>(address), size, overlapped, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING) {
+        
+        executor->destroyOverlapped(overlapped);
+        cb(Corecat::IOException("::WSASendTo failed"), 0);
+        return;
+        
+    }
+#endif
+}
+
+#if defined(NETYCAT_IOEXECUTOR_IOCP)
+std::size_t Socket::transmitFile(HANDLE file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, ExceptionPtr& e) noexcept {
+    
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = DWORD(offset), overlapped.OffsetHigh = DWORD(offset >> 32);
+    overlapped.hEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if(!overlapped.hEvent)
+        { e = Corecat::IOException("::CreateEventW failed"); return 0; }
+    overlapped.hEvent = HANDLE(ULONG_PTR(overlapped.hEvent) | 1);
+    TRANSMIT_FILE_BUFFERS buffers = {const_cast<void*>(head), DWORD(headSize), nullptr, 0};
+    DWORD ret = 0;
+    if((!WSA::TransmitFile(handle, file, DWORD(count), 0, &overlapped, headSize ? &buffers : nullptr, 0)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        || !::WSAGetOverlappedResult(handle, &overlapped, &ret, TRUE, nullptr)) {
+        
+        e = Corecat::IOException("::TransmitFile failed");
+        ret = 0;
+        
+    }
+    ::CloseHandle(HANDLE(ULONG_PTR(overlapped.hEvent) & ~ULONG_PTR(1)));
+    return ret;
+    
+}
+void Socket::transmitFile(HANDLE file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, WriteCallback cb) noexcept {
+    
+    auto buffers = std::make_shared<TRANSMIT_FILE_BUFFERS>();
+    buffers->Head = const_cast<void*>(head), buffers->HeadLength = DWORD(headSize);
+    auto overlapped = executor->createOverlapped([buffers, cb](auto& e, auto count) { cb(e, count); });
+    overlapped->Offset = DWORD(offset), overlapped->OffsetHigh = DWORD(offset >> 32);
+    if(!WSA::TransmitFile(handle, file, DWORD(count), 0, overlapped, headSize ? buffers.get() : nullptr, 0)
+        && ::WSAGetLastError() != ERROR_IO_PENDING) {
+        
+        executor->destroyOverlapped(overlapped);
+        cb(Corecat::IOException("::TransmitFile failed"), 0);
+        return;
+        
+    }
+    
+}
+
+void Socket::connect(const void* address, socklen_t size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    if(!family && !type && !protocol) {
+        
+        getSocketInfo(e);
+        if(e) return;
+        
+    }
+    sockaddr_storage saddr = {};
+    saddr.ss_family = family;
+    if(::bind(handle, reinterpret_cast<sockaddr*>(&saddr), sizeof(saddr)))
+        { e = Corecat::IOException("::bind failed"); return; }
+    if(!WSA::ConnectEx(handle, reinterpret_cast<const sockaddr*>(address), int(size), nullptr, 0, nullptr, operation)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        { e = Corecat::IOException("::ConnectEx failed"); return; }
+    
+}
+
+Socket::NativeHandleType Socket::beginAccept(void* buffer, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    if(!family && !type && !protocol) {
+        
+        getSocketInfo(e);
+        if(e) return INVALID_SOCKET;
+        
+    }
+    SOCKET h = ::socket(family, type, protocol);
+    if(h == INVALID_SOCKET)
+        { e = Corecat::IOException("::socket failed"); return INVALID_SOCKET; }
+    if(!WSA::AcceptEx(handle, h, buffer, 0, sizeof(sockaddr_storage) + 16, sizeof(sockaddr_storage) + 16, nullptr, operation)
+        && ::WSAGetLastError() != ERROR_IO_PENDING) {
+        
+        ::closesocket(h);
+        e = Corecat::IOException("::AcceptEx failed");
+        return INVALID_SOCKET;
+        
+    }
+    return h;
+    
+}
+void Socket::endAccept(Socket& s, NativeHandleType h, const ExceptionPtr& e) noexcept {
+    
+    if(h == INVALID_SOCKET) return;
+    if(e) { ::closesocket(h); return; }
+    ::setsockopt(h, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, reinterpret_cast<const char*>(&handle), sizeof(handle));
+    s.setHandle(h);
+    
+}
+
+void Socket::read(void* buffer, std::size_t count, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    WSABUF buf = {u_long(count), static_cast<char*>(buffer)};
+    DWORD flags = 0;
+    if(::WSARecv(handle, &buf, 1, nullptr, &flags, operation, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        { e = Corecat::IOException("::WSARecv failed"); return; }
+    
+}
+void Socket::readFrom(void* buffer, std::size_t count, void* address, socklen_t& size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    WSABUF buf = {u_long(count), static_cast<char*>(buffer)};
+    DWORD flags = 0;
+    if(::WSARecvFrom(handle, &buf, 1, nullptr, &flags, reinterpret_cast<sockaddr*>(address), &size, operation, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        { e = Corecat::IOException("::WSARecvFrom failed"); return; }
+    
+}
+
+void Socket::write(const void* buffer, std::size_t count, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    WSABUF buf = {u_long(count), static_cast<char*>(const_cast<void*>(buffer))};
+    if(::WSASend(handle, &buf, 1, nullptr, 0, operation, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        { e = Corecat::IOException("::WSASend failed"); return; }
+    
+}
+void Socket::writeTo(const void* buffer, std::size_t count, const void* address, socklen_t size, IOExecutor::Operation* operation, ExceptionPtr& e) noexcept {
+    
+    WSABUF buf = {u_long(count), static_cast<char*>(const_cast<void*>(buffer))};
+    if(::WSASendTo(handle, &buf, 1, nullptr, 0, reinterpret_cast<const sockaddr*>(address), size, operation, nullptr)
+        && ::WSAGetLastError() != ERROR_IO_PENDING)
+        { e = Corecat::IOException("::WSASendTo failed"); return; }
+    
+}
+#endif
+
 void Socket::getRemoteEndpoint(void* address, socklen_t& size, ExceptionPtr& e) noexcept {
     
     if(::getpeername(handle, reinterpret_cast<sockaddr*>(address), &size))
@@ -327,6 +798,31 @@ void Socket::getRemoteEndpoint(void* address, socklen_t& size, ExceptionPtr& e)
     
 }
 
+bool Socket::isReadable(ExceptionPtr& e) noexcept {
+    
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(handle, &readSet);
+    timeval timeout = {};
+    auto ret = ::select(int(handle + 1), &readSet, nullptr, nullptr, &timeout);
+    if(ret < 0) { e = Corecat::IOException("::select failed"); return false; }
+    return ret > 0;
+    
+}
+
+void Socket::setOption(int level, int name, const void* value, socklen_t size, ExceptionPtr& e) noexcept {
+    
+    if(::setsockopt(handle, level, name, static_cast<const char*>(value), size))
+        { e = Corecat::IOException("::setsockopt failed"); return; }
+    
+}
+void Socket::getOption(int level, int name, void* value, socklen_t& size, ExceptionPtr& e) noexcept {
+    
+    if(::getsockopt(handle, level, name, static_cast<char*>(value), &size))
+        { e = Corecat::IOException("::getsockopt failed"); return; }
+    
+}
+
 Socket::NativeHandleType Socket::getHandle() noexcept { return handle; }
 void Socket::setHandle(NativeHandleType handle_) noexcept {
     
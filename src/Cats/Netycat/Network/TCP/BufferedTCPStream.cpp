@@ -0,0 +1,388 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/BufferedTCPStream.hpp"
+
+#include <cstring>
+
+#include <algorithm>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+#include "Cats/Netycat/Network/Impl/Delimiter.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+BufferedTCPStream::BufferedTCPStream(TCPSocket& socket_, std::size_t readCapacity_, std::size_t writeCapacity_) :
+    socket(socket_), readBuffer(new Byte[readCapacity_]), readCapacity(readCapacity_),
+    writeBuffer(new Byte[writeCapacity_]), writeCapacity(writeCapacity_) {}
+BufferedTCPStream::~BufferedTCPStream() {}
+
+void BufferedTCPStream::compact() noexcept {
+    
+    if(readBegin == readEnd) readBegin = readEnd = 0;
+    else if(readBegin) {
+        
+        std::memmove(readBuffer.get(), readBuffer.get() + readBegin, readEnd - readBegin);
+        readEnd -= readBegin, readBegin = 0;
+        
+    }
+    
+}
+std::size_t BufferedTCPStream::take(void* buffer, std::size_t count) noexcept {
+    
+    auto n = std::min(count, readEnd - readBegin);
+    std::memcpy(buffer, readBuffer.get() + readBegin, n);
+    readBegin += n;
+    return n;
+    
+}
+std::size_t BufferedTCPStream::find(const char* delimiter, std::size_t delimiterLength) const noexcept {
+    
+    const Byte* begin = readBuffer.get() + readBegin;
+    const Byte* end = readBuffer.get() + readEnd;
+    auto p = Impl::findDelimiter(begin, end, reinterpret_cast<const Byte*>(delimiter), delimiterLength);
+    return p == end ? 0 : std::size_t(p - begin) + delimiterLength;
+    
+}
+
+void BufferedTCPStream::fill(ExceptionPtr& e) noexcept {
+    
+    compact();
+    auto n = socket.read(readBuffer.get() + readEnd, readCapacity - readEnd, e);
+    if(e) return;
+    if(!n) { e = Corecat::IOException("Connection closed"); return; }
+    readEnd += n;
+    
+}
+void BufferedTCPStream::fill(FlushCallback cb) noexcept {
+    
+    compact();
+    auto self = this;
+    socket.read(readBuffer.get() + readEnd, readCapacity - readEnd, [=](auto& e, auto n) {
+        
+        if(e) { cb(e); return; }
+        if(!n) { cb(Corecat::IOException("Connection closed")); return; }
+        self->readEnd += n;
+        cb(ExceptionPtr());
+        
+    });
+    
+}
+
+std::size_t BufferedTCPStream::readExactly(void* buffer, std::size_t count) {
+    
+    ExceptionPtr e;
+    auto ret = readExactly(buffer, count, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t BufferedTCPStream::readExactly(void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
+    
+    auto p = static_cast<Byte*>(buffer);
+    auto n = count - take(p, count);
+    p += count - n;
+    while(n >= readCapacity) {
+        
+        auto ret = socket.read(p, n, e);
+        if(e) return 0;
+        if(!ret) { e = Corecat::IOException("Connection closed"); return 0; }
+        p += ret, n -= ret;
+        
+    }
+    while(n) {
+        
+        fill(e);
+        if(e) return 0;
+        auto ret = take(p, n);
+        p += ret, n -= ret;
+        
+    }
+    return count;
+    
+}
+void BufferedTCPStream::readExactlyImpl(Byte* buffer, std::size_t n, ReadCallback cb, std::size_t count) noexcept {
+    
+    auto self = this;
+    if(!n) cb(ExceptionPtr(), count);
+    else if(n >= readCapacity) {
+        
+        socket.read(buffer, n, [=](auto& e, auto c) {
+            
+            if(e) cb(e, 0);
+            else if(!c) cb(Corecat::IOException("Connection closed"), 0);
+            else self->readExactlyImpl(buffer + c, n - c, cb, count);
+            
+        });
+        
+    } else {
+        
+        fill([=](auto& e) {
+            
+            if(e) { cb(e, 0); return; }
+            auto c = self->take(buffer, n);
+            self->readExactlyImpl(buffer + c, n - c, cb, count);
+            
+        });
+        
+    }
+    
+}
+void BufferedTCPStream::readExactly(void* buffer, std::size_t count, ReadCallback cb) noexcept {
+    
+    auto p = static_cast<Byte*>(buffer);
+    auto c = take(p, count);
+    readExactlyImpl(p + c, count - c, std::move(cb), count);
+    
+}
+Corecat::Promise<std::size_t> BufferedTCPStream::readExactlyAsync(void* buffer, std::size_t count) noexcept {
+    
+    Promise<std::size_t> promise;
+    readExactly(buffer, count, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
+std::size_t BufferedTCPStream::readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength) {
+    
+    ExceptionPtr e;
+    auto ret = readUntil(buffer, count, delimiter, delimiterLength, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t BufferedTCPStream::readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, ExceptionPtr& e) noexcept {
+    
+    if(!delimiterLength || delimiterLength > readCapacity) { e = Corecat::InvalidArgumentException("Invalid delimiter"); return 0; }
+    auto p = static_cast<Byte*>(buffer);
+    for(std::size_t copied = 0; ; ) {
+        
+        auto n = find(delimiter, delimiterLength);
+        auto size = getReadSize();
+        if(n ? copied + n > count : copied + size >= count) { e = Corecat::IOException("Delimiter not found"); return 0; }
+        if(n) return copied + take(p + copied, n);
+        if(size >= delimiterLength) copied += take(p + copied, size - delimiterLength + 1);
+        fill(e);
+        if(e) return 0;
+        
+    }
+    
+}
+void BufferedTCPStream::readUntilImpl(Byte* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, std::size_t copied, ReadCallback cb) noexcept {
+    
+    auto n = find(delimiter, delimiterLength);
+    auto size = getReadSize();
+    if(n ? copied + n > count : copied + size >= count) { cb(Corecat::IOException("Delimiter not found"), 0); return; }
+    if(n) { cb(ExceptionPtr(), copied + take(buffer + copied, n)); return; }
+    if(size >= delimiterLength) copied += take(buffer + copied, size - delimiterLength + 1);
+    auto self = this;
+    fill([=](auto& e) {
+        
+        if(e) cb(e, 0);
+        else self->readUntilImpl(buffer, count, delimiter, delimiterLength, copied, cb);
+        
+    });
+    
+}
+void BufferedTCPStream::readUntil(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength, ReadCallback cb) noexcept {
+    
+    if(!delimiterLength || delimiterLength > readCapacity) { cb(Corecat::InvalidArgumentException("Invalid delimiter"), 0); return; }
+    readUntilImpl(static_cast<Byte*>(buffer), count, delimiter, delimiterLength, 0, std::move(cb));
+    
+}
+Corecat::Promise<std::size_t> BufferedTCPStream::readUntilAsync(void* buffer, std::size_t count, const char* delimiter, std::size_t delimiterLength) noexcept {
+    
+    Promise<std::size_t> promise;
+    readUntil(buffer, count, delimiter, delimiterLength, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
+std::size_t BufferedTCPStream::peek(void* buffer, std::size_t count) {
+    
+    ExceptionPtr e;
+    auto ret = peek(buffer, count, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t BufferedTCPStream::peek(void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
+    
+    count = std::min(count, readCapacity);
+    while(getReadSize() < count) {
+        
+        fill(e);
+        if(e) return 0;
+        
+    }
+    std::memcpy(buffer, readBuffer.get() + readBegin, count);
+    return count;
+    
+}
+void BufferedTCPStream::peekImpl(Byte* buffer, std::size_t count, ReadCallback cb) noexcept {
+    
+    if(getReadSize() >= count) {
+        
+        std::memcpy(buffer, readBuffer.get() + readBegin, count);
+        cb(ExceptionPtr(), count);
+        return;
+        
+    }
+    auto self = this;
+    fill([=](auto& e) {
+        
+        if(e) cb(e, 0);
+        else self->peekImpl(buffer, count, cb);
+        
+    });
+    
+}
+void BufferedTCPStream::peek(void* buffer, std::size_t count, ReadCallback cb) noexcept {
+    
+    peekImpl(static_cast<Byte*>(buffer), std::min(count, readCapacity), std::move(cb));
+    
+}
+Corecat::Promise<std::size_t> BufferedTCPStream::peekAsync(void* buffer, std::size_t count) noexcept {
+    
+    Promise<std::size_t> promise;
+    peek(buffer, count, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
+std::size_t BufferedTCPStream::write(const void* buffer, std::size_t count) {
+    
+    ExceptionPtr e;
+    auto ret = write(buffer, count, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t BufferedTCPStream::write(const void* buffer, std::size_t count, ExceptionPtr& e) noexcept {
+    
+    if(writeSize + count < writeCapacity) {
+        
+        std::memcpy(writeBuffer.get() + writeSize, buffer, count);
+        writeSize += count;
+        return count;
+        
+    }
+    flush(e);
+    if(e) return 0;
+    if(count >= writeCapacity) return socket.writeAll(buffer, count, e);
+    std::memcpy(writeBuffer.get(), buffer, count);
+    writeSize = count;
+    return count;
+    
+}
+void BufferedTCPStream::write(const void* buffer, std::size_t count, WriteCallback cb) noexcept {
+    
+    if(writeSize + count < writeCapacity) {
+        
+        std::memcpy(writeBuffer.get() + writeSize, buffer, count);
+        writeSize += count;
+        cb(ExceptionPtr(), count);
+        return;
+        
+    }
+    auto self = this;
+    flush([=](auto& e) {
+        
+        if(e) cb(e, 0);
+        else if(count >= self->writeCapacity) self->socket.writeAll(buffer, count, cb);
+        else {
+            
+            std::memcpy(self->writeBuffer.get(), buffer, count);
+            self->writeSize = count;
+            cb(ExceptionPtr(), count);
+            
+        }
+        
+    });
+    
+}
+Corecat::Promise<std::size_t> BufferedTCPStream::writeAsync(const void* buffer, std::size_t count) noexcept {
+    
+    Promise<std::size_t> promise;
+    write(buffer, count, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
+void BufferedTCPStream::flush() {
+    
+    ExceptionPtr e;
+    flush(e);
+    if(e) e.rethrow();
+    
+}
+void BufferedTCPStream::flush(ExceptionPtr& e) noexcept {
+    
+    if(!writeSize) return;
+    socket.writeAll(writeBuffer.get(), writeSize, e);
+    if(e) return;
+    writeSize = 0;
+    
+}
+void BufferedTCPStream::flush(FlushCallback cb) noexcept {
+    
+    if(!writeSize) { cb(ExceptionPtr()); return; }
+    auto self = this;
+    socket.writeAll(writeBuffer.get(), writeSize, [=](auto& e, auto) {
+        
+        if(!e) self->writeSize = 0;
+        cb(e);
+        
+    });
+    
+}
+Corecat::Promise<> BufferedTCPStream::flushAsync() noexcept {
+    
+    Promise<> promise;
+    flush([=](auto& e) {
+        e ? promise.reject(e) : promise.resolve();
+    });
+    return promise;
+    
+}
+
+}
+}
+}
+}
@@ -0,0 +1,445 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPConnectionPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Cats/Corecat/Time/HighResolutionClock.hpp"
+#include "Cats/Corecat/Util/Exception.hpp"
+#include "Cats/Netycat/Network/Impl/Hash.hpp"
+#include "Cats/Netycat/Network/TCP/TCPOption.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+class TCPConnectionPool::State : public std::enable_shared_from_this<State> {
+    
+private:
+    
+    using TimePoint = Corecat::HighResolutionClock::time_point;
+    
+    struct Key {
+        
+        IOExecutor* executor;
+        EndpointType endpoint;
+        
+        friend bool operator ==(const Key& a, const Key& b) noexcept { return a.executor == b.executor && a.endpoint == b.endpoint; }
+        
+    };
+    struct KeyHash {
+        
+        std::size_t operator ()(const Key& key) const noexcept {
+            return std::size_t(Impl::mixHash(std::uint64_t(reinterpret_cast<std::uintptr_t>(key.executor)), key.endpoint.getHash()));
+        }
+        
+    };
+    
+    struct Idle {
+        
+        std::unique_ptr<TCPSocket> socket;
+        TimePoint since;
+        
+    };
+    struct Bucket {
+        
+        IOExecutor& executor;
+        EndpointType endpoint;
+        std::vector<Idle> idle;
+        std::deque<CheckoutCallback> waiting;
+        std::size_t size = 0;
+        bool reaping = false;
+        
+        Bucket(IOExecutor& executor_, const EndpointType& endpoint_) : executor(executor_), endpoint(endpoint_) {}
+        
+    };
+    struct Shard {
+        
+        std::mutex mutex;
+        std::unordered_map<Key, std::unique_ptr<Bucket>, KeyHash> bucketMap;
+        
+    };
+    
+private:
+    
+    std::size_t minSize;
+    std::size_t maxSize;
+    double idleTimeout;
+    Shard shards[SHARD_COUNT];
+    std::atomic<bool> closed{false};
+    
+private:
+    
+    Shard& getShard(const Key& key) noexcept { return shards[KeyHash()(key) % SHARD_COUNT]; }
+    Bucket& getBucket(Shard& shard, const Key& key);
+    
+    void connect(Shard& shard, Bucket& bucket, CheckoutCallback cb);
+    SocketPtr wrap(Shard& shard, Bucket& bucket, std::unique_ptr<TCPSocket> socket);
+    void release(Shard& shard, Bucket& bucket, TCPSocket* p) noexcept;
+    void discard(Shard& shard, Bucket& bucket);
+    void fill(Shard& shard, Bucket& bucket, WarmUpCallback cb);
+    void scheduleReap(Shard& shard, Bucket& bucket);
+    void reap(Shard& shard, Bucket& bucket);
+    
+public:
+    
+    State(std::size_t minSize_, std::size_t maxSize_, double idleTimeout_) :
+        minSize(minSize_), maxSize(maxSize_ ? maxSize_ : 1), idleTimeout(idleTimeout_) {}
+    
+    void checkout(IOExecutor& executor, const EndpointType& endpoint, CheckoutCallback cb);
+    void warmUp(IOExecutor& executor, const EndpointType& endpoint, WarmUpCallback cb);
+    void close() noexcept;
+    
+    std::size_t getMinSize() const noexcept { return minSize; }
+    std::size_t getMaxSize() const noexcept { return maxSize; }
+    double getIdleTimeout() const noexcept { return idleTimeout; }
+    std::size_t getSize(IOExecutor& executor, const EndpointType& endpoint) noexcept;
+    std::size_t getIdleCount(IOExecutor& executor, const EndpointType& endpoint) noexcept;
+    
+};
+
+TCPConnectionPool::State::Bucket& TCPConnectionPool::State::getBucket(Shard& shard, const Key& key) {
+    
+    auto& bucket = shard.bucketMap[key];
+    if(!bucket) bucket.reset(new Bucket(*key.executor, key.endpoint));
+    return *bucket;
+    
+}
+
+void TCPConnectionPool::State::connect(Shard& shard, Bucket& bucket, CheckoutCallback cb) {
+    
+    auto self = shared_from_this();
+    auto s = &shard;
+    auto b = &bucket;
+    auto socket = new TCPSocket(bucket.executor);
+    socket->connect(bucket.endpoint, [=](auto& e) {
+        
+        std::unique_ptr<TCPSocket> p(socket);
+        if(e) { self->discard(*s, *b); cb(e, nullptr); return; }
+        ExceptionPtr ignored;
+        p->setOption(TCPOption::noDelay(), ignored);
+        cb(ExceptionPtr(), self->wrap(*s, *b, std::move(p)));
+        
+    });
+    
+}
+TCPConnectionPool::SocketPtr TCPConnectionPool::State::wrap(Shard& shard, Bucket& bucket, std::unique_ptr<TCPSocket> socket) {
+    
+    auto self = shared_from_this();
+    auto s = &shard;
+    auto b = &bucket;
+    return SocketPtr(socket.release(), [=](TCPSocket* p) { self->release(*s, *b, p); });
+    
+}
+void TCPConnectionPool::State::release(Shard& shard, Bucket& bucket, TCPSocket* p) noexcept {
+    
+    std::unique_ptr<TCPSocket> socket(p);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    if(closed || !socket->getHandle()) {
+        
+        lock.unlock();
+        socket.reset();
+        if(!closed) {
+            
+            auto self = shared_from_this();
+            auto s = &shard;
+            auto b = &bucket;
+            bucket.executor.execute([=] { self->discard(*s, *b); self->fill(*s, *b, nullptr); });
+            
+        } else discard(shard, bucket);
+        return;
+        
+    }
+    if(!bucket.waiting.empty()) {
+        
+        auto cb = std::move(bucket.waiting.front());
+        bucket.waiting.pop_front();
+        lock.unlock();
+        auto self = shared_from_this();
+        auto s = &shard;
+        auto b = &bucket;
+        auto raw = socket.release();
+        bucket.executor.execute([=] { cb(ExceptionPtr(), self->wrap(*s, *b, std::unique_ptr<TCPSocket>(raw))); });
+        return;
+        
+    }
+    bucket.idle.push_back({std::move(socket), Corecat::HighResolutionClock::now()});
+    bool reap = !bucket.reaping && bucket.idle.size() > minSize;
+    if(reap) bucket.reaping = true;
+    lock.unlock();
+    if(reap) {
+        
+        auto self = shared_from_this();
+        auto s = &shard;
+        auto b = &bucket;
+        bucket.executor.execute([=] { self->scheduleReap(*s, *b); });
+        
+    }
+    
+}
+void TCPConnectionPool::State::discard(Shard& shard, Bucket& bucket) {
+    
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    --bucket.size;
+    if(closed || bucket.waiting.empty()) return;
+    auto cb = std::move(bucket.waiting.front());
+    bucket.waiting.pop_front();
+    ++bucket.size;
+    lock.unlock();
+    connect(shard, bucket, std::move(cb));
+    
+}
+void TCPConnectionPool::State::fill(Shard& shard, Bucket& bucket, WarmUpCallback cb) {
+    
+    std::size_t count;
+    {
+        
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        count = bucket.size < minSize ? minSize - bucket.size : 0;
+        bucket.size += count;
+        
+    }
+    if(!count) { if(cb) cb(ExceptionPtr()); return; }
+    auto remaining = std::make_shared<std::size_t>(count);
+    auto exception = std::make_shared<ExceptionPtr>();
+    for(std::size_t i = 0; i < count; ++i) {
+        
+        connect(shard, bucket, [=](auto& e, auto) {
+            
+            if(e) *exception = e;
+            if(!--*remaining && cb) cb(*exception);
+            
+        });
+        
+    }
+    
+}
+void TCPConnectionPool::State::scheduleReap(Shard& shard, Bucket& bucket) {
+    
+    TimePoint oldest;
+    {
+        
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if(closed || bucket.idle.size() <= minSize) { bucket.reaping = false; return; }
+        oldest = bucket.idle.front().since;
+        
+    }
+    std::chrono::duration<double> time = oldest - Corecat::HighResolutionClock::now();
+    auto delay = time.count() + idleTimeout;
+    auto self = shared_from_this();
+    auto s = &shard;
+    auto b = &bucket;
+    bucket.executor.wait(delay > 0 ? delay : 0, [=] { self->reap(*s, *b); });
+    
+}
+void TCPConnectionPool::State::reap(Shard& shard, Bucket& bucket) {
+    
+    std::vector<std::unique_ptr<TCPSocket>> expired;
+    {
+        
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto now = Corecat::HighResolutionClock::now();
+        std::size_t count = 0;
+        while(count < bucket.idle.size() && bucket.idle.size() - count > minSize) {
+            
+            std::chrono::duration<double> time = now - bucket.idle[count].since;
+            if(time.count() < idleTimeout) break;
+            expired.push_back(std::move(bucket.idle[count].socket));
+            ++count;
+            
+        }
+        bucket.idle.erase(bucket.idle.begin(), bucket.idle.begin() + count);
+        bucket.size -= count;
+        
+    }
+    expired.clear();
+    scheduleReap(shard, bucket);
+    
+}
+
+void TCPConnectionPool::State::checkout(IOExecutor& executor, const EndpointType& endpoint, CheckoutCallback cb) {
+    
+    Key key{&executor, endpoint};
+    auto& shard = getShard(key);
+    std::vector<std::unique_ptr<TCPSocket>> broken;
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    if(closed) { lock.unlock(); cb(Corecat::IOException("Connection pool closed"), nullptr); return; }
+    auto& bucket = getBucket(shard, key);
+    while(!bucket.idle.empty()) {
+        
+        auto socket = std::move(bucket.idle.back().socket);
+        bucket.idle.pop_back();
+        lock.unlock();
+        ExceptionPtr e;
+        if(!socket->isReadable(e) && !e) {
+            
+            if(!broken.empty()) fill(shard, bucket, nullptr);
+            cb(ExceptionPtr(), wrap(shard, bucket, std::move(socket)));
+            return;
+            
+        }
+        broken.push_back(std::move(socket));
+        lock.lock();
+        --bucket.size;
+        if(closed) { lock.unlock(); cb(Corecat::IOException("Connection pool closed"), nullptr); return; }
+        
+    }
+    if(bucket.size < maxSize) {
+        
+        ++bucket.size;
+        lock.unlock();
+        if(!broken.empty()) fill(shard, bucket, nullptr);
+        connect(shard, bucket, std::move(cb));
+        return;
+        
+    }
+    bucket.waiting.push_back(std::move(cb));
+    
+}
+void TCPConnectionPool::State::warmUp(IOExecutor& executor, const EndpointType& endpoint, WarmUpCallback cb) {
+    
+    Key key{&executor, endpoint};
+    auto& shard = getShard(key);
+    Bucket* bucket;
+    {
+        
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if(!closed) bucket = &getBucket(shard, key);
+        else bucket = nullptr;
+        
+    }
+    if(!bucket) { cb(Corecat::IOException("Connection pool closed")); return; }
+    fill(shard, *bucket, std::move(cb));
+    
+}
+void TCPConnectionPool::State::close() noexcept {
+    
+    closed = true;
+    for(auto& shard : shards) {
+        
+        std::vector<std::unique_ptr<TCPSocket>> list;
+        std::vector<std::pair<IOExecutor*, std::deque<CheckoutCallback>>> waitingList;
+        {
+            
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for(auto& x : shard.bucketMap) {
+                
+                auto& bucket = *x.second;
+                for(auto& idle : bucket.idle) list.push_back(std::move(idle.socket));
+                bucket.size -= bucket.idle.size();
+                bucket.idle.clear();
+                if(!bucket.waiting.empty()) waitingList.emplace_back(&bucket.executor, std::move(bucket.waiting));
+                bucket.waiting.clear();
+                
+            }
+            
+        }
+        list.clear();
+        for(auto& x : waitingList) {
+            
+            auto waiting = std::make_shared<std::deque<CheckoutCallback>>(std::move(x.second));
+            x.first->execute([=] { for(auto& cb : *waiting) cb(Corecat::IOException("Connection pool closed"), nullptr); });
+            
+        }
+        
+    }
+    
+}
+
+std::size_t TCPConnectionPool::State::getSize(IOExecutor& executor, const EndpointType& endpoint) noexcept {
+    
+    Key key{&executor, endpoint};
+    auto& shard = getShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto p = shard.bucketMap.find(key);
+    return p != shard.bucketMap.end() ? p->second->size : 0;
+    
+}
+std::size_t TCPConnectionPool::State::getIdleCount(IOExecutor& executor, const EndpointType& endpoint) noexcept {
+    
+    Key key{&executor, endpoint};
+    auto& shard = getShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto p = shard.bucketMap.find(key);
+    return p != shard.bucketMap.end() ? p->second->idle.size() : 0;
+    
+}
+
+TCPConnectionPool::TCPConnectionPool(std::size_t minSize, std::size_t maxSize, double idleTimeout) :
+    state(std::make_shared<State>(minSize, maxSize, idleTimeout)) {}
+TCPConnectionPool::~TCPConnectionPool() { state->close(); }
+
+void TCPConnectionPool::checkout(IOExecutor& executor, const EndpointType& endpoint, CheckoutCallback cb) {
+    
+    state->checkout(executor, endpoint, std::move(cb));
+    
+}
+Corecat::Promise<TCPConnectionPool::SocketPtr> TCPConnectionPool::checkoutAsync(IOExecutor& executor, const EndpointType& endpoint) {
+    
+    Promise<SocketPtr> promise;
+    checkout(executor, endpoint, [=](auto& e, auto socket) {
+        e ? promise.reject(e) : promise.resolve(std::move(socket));
+    });
+    return promise;
+    
+}
+
+void TCPConnectionPool::warmUp(IOExecutor& executor, const EndpointType& endpoint, WarmUpCallback cb) {
+    
+    state->warmUp(executor, endpoint, std::move(cb));
+    
+}
+Corecat::Promise<> TCPConnectionPool::warmUpAsync(IOExecutor& executor, const EndpointType& endpoint) {
+    
+    Promise<> promise;
+    warmUp(executor, endpoint, [=](auto& e) {
+        e ? promise.reject(e) : promise.resolve();
+    });
+    return promise;
+    
+}
+
+void TCPConnectionPool::close() noexcept { state->close(); }
+
+std::size_t TCPConnectionPool::getMinSize() const noexcept { return state->getMinSize(); }
+std::size_t TCPConnectionPool::getMaxSize() const noexcept { return state->getMaxSize(); }
+double TCPConnectionPool::getIdleTimeout() const noexcept { return state->getIdleTimeout(); }
+std::size_t TCPConnectionPool::getSize(IOExecutor& executor, const EndpointType& endpoint) const noexcept { return state->getSize(executor, endpoint); }
+std::size_t TCPConnectionPool::getIdleCount(IOExecutor& executor, const EndpointType& endpoint) const noexcept { return state->getIdleCount(executor, endpoint); }
+
+}
+}
+}
+}
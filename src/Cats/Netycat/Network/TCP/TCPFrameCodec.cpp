@@ -0,0 +1,165 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPFrameCodec.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+#include "Cats/Netycat/Network/Impl/Delimiter.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+std::size_t TCPFrameCodec::decode(const Byte* data, std::size_t size, std::size_t& frameOffset, std::size_t& frameSize, std::size_t& scanned, ExceptionPtr& e) const noexcept {
+    
+    switch(type) {
+    
+    case Type::FixedLength: {
+        
+        if(size < prefixSize) return 0;
+        std::uint64_t length = 0;
+        for(std::size_t i = 0; i < prefixSize; ++i) length = length << 8 | data[i];
+        if(length > maxFrameSize) { e = Corecat::IOException("Frame too large"); return 0; }
+        if(size - prefixSize < length) return 0;
+        frameOffset = prefixSize, frameSize = std::size_t(length);
+        return prefixSize + frameSize;
+        
+    }
+    
+    case Type::VarintLength: {
+        
+        std::uint64_t length = 0;
+        std::size_t i = 0;
+        for(;; ++i) {
+            
+            if(i == MAX_VARINT_SIZE) { e = Corecat::IOException("Invalid varint"); return 0; }
+            if(i == size) return 0;
+            if(i == MAX_VARINT_SIZE - 1 && data[i] > 1) { e = Corecat::IOException("Invalid varint"); return 0; }
+            length |= std::uint64_t(data[i] & 0x7F) << (7 * i);
+            if(!(data[i] & 0x80)) break;
+            
+        }
+        if(length > maxFrameSize) { e = Corecat::IOException("Frame too large"); return 0; }
+        if(size - i - 1 < length) return 0;
+        frameOffset = i + 1, frameSize = std::size_t(length);
+        return frameOffset + frameSize;
+        
+    }
+    
+    case Type::Delimiter: {
+        
+        auto d = reinterpret_cast<const Byte*>(delimiter.data());
+        auto n = delimiter.size();
+        auto p = Impl::findDelimiter(data + scanned, data + size, d, n);
+        if(p == data + size) {
+            
+            scanned = size >= n ? size - n + 1 : 0;
+            if(scanned > maxFrameSize) { e = Corecat::IOException("Frame too large"); return 0; }
+            return 0;
+            
+        }
+        scanned = 0;
+        frameOffset = 0, frameSize = std::size_t(p - data);
+        if(frameSize > maxFrameSize) { e = Corecat::IOException("Frame too large"); return 0; }
+        return frameSize + n;
+        
+    }
+    
+    default: return 0;
+    
+    }
+    
+}
+
+void TCPFrameCodec::encode(IOBuffer& frame) const {
+    
+    auto size = frame.getSize();
+    if(size > maxFrameSize) throw Corecat::InvalidArgumentException("Frame too large");
+    switch(type) {
+    
+    case Type::FixedLength: {
+        
+        auto p = frame.prepend(prefixSize);
+        for(std::size_t i = prefixSize; i--; size >>= 8) p[i] = Byte(size & 0xFF);
+        break;
+        
+    }
+    
+    case Type::VarintLength: {
+        
+        Byte header[MAX_VARINT_SIZE];
+        std::size_t n = 0;
+        for(; size >= 0x80; size >>= 7) header[n++] = Byte((size & 0x7F) | 0x80);
+        header[n++] = Byte(size);
+        std::memcpy(frame.prepend(n), header, n);
+        break;
+        
+    }
+    
+    case Type::Delimiter: frame.append(delimiter.data(), delimiter.size()); break;
+    
+    }
+    
+}
+IOBuffer TCPFrameCodec::encode(const void* data, std::size_t count) const {
+    
+    IOBuffer frame(data, count, getHeaderSize(), getTrailerSize());
+    encode(frame);
+    return frame;
+    
+}
+
+TCPFrameCodec TCPFrameCodec::fixedLength(std::size_t prefixSize, std::size_t maxFrameSize) {
+    
+    if(prefixSize != 1 && prefixSize != 2 && prefixSize != 4 && prefixSize != 8)
+        throw Corecat::InvalidArgumentException("Invalid prefix size");
+    if(prefixSize < sizeof(std::size_t)) {
+        
+        auto limit = (std::size_t(1) << (8 * prefixSize)) - 1;
+        if(maxFrameSize > limit) maxFrameSize = limit;
+        
+    }
+    return {Type::FixedLength, prefixSize, maxFrameSize};
+    
+}
+TCPFrameCodec TCPFrameCodec::varintLength(std::size_t maxFrameSize) noexcept { return {Type::VarintLength, 0, maxFrameSize}; }
+TCPFrameCodec TCPFrameCodec::delimited(const char* delimiter, std::size_t delimiterLength, std::size_t maxFrameSize) {
+    
+    if(!delimiterLength) throw Corecat::InvalidArgumentException("Invalid delimiter");
+    return {Type::Delimiter, 0, maxFrameSize, std::string(delimiter, delimiterLength)};
+    
+}
+
+}
+}
+}
+}
@@ -0,0 +1,149 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPFrameReader.hpp"
+
+#include <cstring>
+
+#include <new>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+TCPFrameReader::TCPFrameReader(TCPSocket& socket_, TCPFrameCodec codec_, std::size_t capacity_) :
+    socket(socket_), codec(std::move(codec_)), buffer(new Byte[capacity_]), capacity(capacity_) {}
+TCPFrameReader::~TCPFrameReader() {}
+
+bool TCPFrameReader::decode(const Byte*& data, std::size_t& size, ExceptionPtr& e) noexcept {
+    
+    std::size_t offset;
+    auto n = codec.decode(buffer.get() + begin, end - begin, offset, size, scanned, e);
+    if(e || !n) return false;
+    data = buffer.get() + begin + offset;
+    begin += n;
+    return true;
+    
+}
+void TCPFrameReader::prepare(ExceptionPtr& e) noexcept {
+    
+    if(begin == end) begin = end = 0;
+    else if(begin && capacity - end < capacity / 2) {
+        
+        std::memmove(buffer.get(), buffer.get() + begin, end - begin);
+        end -= begin, begin = 0;
+        
+    }
+    if(end < capacity) return;
+    std::unique_ptr<Byte[]> newBuffer(new(std::nothrow) Byte[capacity * 2]);
+    if(!newBuffer) { e = Corecat::IOException("Frame buffer allocation failed"); return; }
+    std::memcpy(newBuffer.get(), buffer.get(), end);
+    buffer = std::move(newBuffer);
+    capacity *= 2;
+    
+}
+void TCPFrameReader::fill(ExceptionPtr& e) noexcept {
+    
+    prepare(e);
+    if(e) return;
+    auto n = socket.read(buffer.get() + end, capacity - end, e);
+    if(e) return;
+    if(!n) { e = Corecat::IOException("Connection closed"); return; }
+    end += n;
+    
+}
+void TCPFrameReader::fill(FillCallback cb) noexcept {
+    
+    ExceptionPtr e;
+    prepare(e);
+    if(e) { cb(e); return; }
+    auto self = this;
+    socket.read(buffer.get() + end, capacity - end, [=](auto& e, auto n) {
+        
+        if(e) { cb(e); return; }
+        if(!n) { cb(Corecat::IOException("Connection closed")); return; }
+        self->end += n;
+        cb(ExceptionPtr());
+        
+    });
+    
+}
+
+std::size_t TCPFrameReader::read(const Byte*& data) {
+    
+    ExceptionPtr e;
+    auto ret = read(data, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t TCPFrameReader::read(const Byte*& data, ExceptionPtr& e) noexcept {
+    
+    std::size_t size;
+    while(!decode(data, size, e)) {
+        
+        if(e) return 0;
+        fill(e);
+        if(e) return 0;
+        
+    }
+    return size;
+    
+}
+void TCPFrameReader::read(ReadCallback cb) noexcept {
+    
+    const Byte* data;
+    std::size_t size;
+    ExceptionPtr e;
+    if(decode(data, size, e)) { cb(ExceptionPtr(), data, size); return; }
+    if(e) { cb(e, nullptr, 0); return; }
+    auto self = this;
+    fill([=](auto& e) {
+        
+        if(e) cb(e, nullptr, 0);
+        else self->read(cb);
+        
+    });
+    
+}
+Corecat::Promise<std::pair<const Corecat::Byte*, std::size_t>> TCPFrameReader::readAsync() noexcept {
+    
+    Promise<std::pair<const Byte*, std::size_t>> promise;
+    read([=](auto& e, auto data, auto size) {
+        e ? promise.reject(e) : promise.resolve(std::pair<const Byte*, std::size_t>(data, size));
+    });
+    return promise;
+    
+}
+
+}
+}
+}
+}
@@ -0,0 +1,51 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPOption.hpp"
+
+#include <cmath>
+
+#include "Cats/Netycat/Network/Impl/Socket.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+TCPOption TCPOption::noDelay(bool enable) noexcept { return {IPPROTO_TCP, TCP_NODELAY, enable}; }
+TCPOption TCPOption::sendBufferSize(std::size_t size) noexcept { return {SOL_SOCKET, SO_SNDBUF, int(size)}; }
+TCPOption TCPOption::receiveBufferSize(std::size_t size) noexcept { return {SOL_SOCKET, SO_RCVBUF, int(size)}; }
+TCPOption TCPOption::keepAlive(bool enable) noexcept { return {SOL_SOCKET, SO_KEEPALIVE, enable}; }
+TCPOption TCPOption::keepAliveIdle(double seconds) noexcept { return {IPPROTO_TCP, TCP_KEEPALIVE, int(std::ceil(seconds))}; }
+TCPOption TCPOption::keepAliveInterval(double seconds) noexcept { return {IPPROTO_TCP, TCP_KEEPINTVL, int(std::ceil(seconds))}; }
+TCPOption TCPOption::keepAliveCount(std::size_t count) noexcept { return {IPPROTO_TCP, TCP_KEEPCNT, int(count)}; }
+TCPOption TCPOption::userTimeout(double seconds) noexcept { return {IPPROTO_TCP, TCP_MAXRT, int(std::ceil(seconds))}; }
+
+}
+}
+}
+}
@@ -26,6 +26,8 @@
 
 #include "Cats/Netycat/Network/TCP/TCPServer.hpp"
 
+#include <algorithm>
+
 #include "Cats/Corecat/Util/Endian.hpp"
 
 #include "Cats/Netycat/Network/Impl/Address.hpp"
@@ -74,6 +76,13 @@ void TCPServer::listen(const IPAddress& address, std::uint16_t port, std::size_t
     case IPAddress::Type::IPv4: socket.socket(AF_INET, SOCK_STREAM, IPPROTO_TCP, e); if(e) return; break;
     case IPAddress::Type::IPv6: socket.socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP, e); if(e) return; break;
     default: e = Corecat::InvalidArgumentException("Invalid address type"); return;
+    }
+    for(auto&& x : options) {
+        
+        int value = x.getValue();
+        socket.setOption(x.getLevel(), x.getName(), &value, sizeof(value), e);
+        if(e) { close(); return; }
+        
     }
     sockaddr_storage saddr;
     socklen_t saddrSize = sizeof(saddr);
@@ -95,8 +104,28 @@ void TCPServer::accept(TCPSocket& s) {
     if(e) e.rethrow();
     
 }
-void TCPServer::accept(TCPSocket& s, ExceptionPtr& e) noexcept { socket.accept(s.socket, e); }
-void TCPServer::accept(TCPSocket& s, AcceptCallback cb) noexcept { socket.accept(s.socket, std::move(cb)); }
+void TCPServer::accept(TCPSocket& s, ExceptionPtr& e) noexcept {
+    
+    socket.accept(s.socket, e);
+    if(e) return;
+    applyOptions(s.socket, e);
+    if(e) s.close();
+    
+}
+void TCPServer::accept(TCPSocket& s, AcceptCallback cb) noexcept {
+    
+    auto self = this;
+    socket.accept(s.socket, [=, &s](auto& e) {
+        
+        if(e) { cb(e); return; }
+        ExceptionPtr e2;
+        self->applyOptions(s.socket, e2);
+        if(e2) s.close();
+        cb(e2);
+        
+    });
+    
+}
 Corecat::Promise<> TCPServer::acceptAsync(TCPSocket& s) noexcept {
     
     Promise<> promise;
@@ -107,6 +136,65 @@ Corecat::Promise<> TCPServer::acceptAsync(TCPSocket& s) noexcept {
     
 }
 
+void TCPServer::acceptLoop(AcceptLoopCallback cb, std::size_t count) noexcept {
+    
+    acceptLoop(*socket.getExecutor(), std::move(cb), count);
+    
+}
+void TCPServer::acceptLoop(IOExecutor& executor_, AcceptLoopCallback cb, std::size_t count) noexcept {
+    
+    auto self = this;
+    auto executor = &executor_;
+    socket.acceptLoop(count, executor_, [=](auto& e, auto handle) {
+        
+        TCPSocket s(*executor);
+        if(e) { cb(e, s); return; }
+        s.setHandle(handle);
+        ExceptionPtr e2;
+        self->applyOptions(s.socket, e2);
+        if(e2) s.close();
+        cb(e2, s);
+        
+    });
+    
+}
+
+void TCPServer::setOption(const TCPOption& option) {
+    
+    ExceptionPtr e;
+    setOption(option, e);
+    if(e) e.rethrow();
+    
+}
+void TCPServer::setOption(const TCPOption& option, ExceptionPtr& e) noexcept {
+    
+    if(socket.getHandle()) {
+        
+        int value = option.getValue();
+        socket.setOption(option.getLevel(), option.getName(), &value, sizeof(value), e);
+        if(e) return;
+        
+    }
+    auto p = std::find_if(options.begin(), options.end(), [&](auto& x) {
+        return x.getLevel() == option.getLevel() && x.getName() == option.getName();
+    });
+    if(p != options.end()) *p = option;
+    else options.push_back(option);
+    
+}
+
+void TCPServer::applyOptions(Impl::Socket& s, ExceptionPtr& e) noexcept {
+    
+    for(auto&& x : options) {
+        
+        int value = x.getValue();
+        s.setOption(x.getLevel(), x.getName(), &value, sizeof(value), e);
+        if(e) return;
+        
+    }
+    
+}
+
 TCPServer::NativeHandleType TCPServer::getHandle() noexcept { return socket.getHandle(); }
 void TCPServer::setHandle(NativeHandleType handle) noexcept { socket.setHandle(handle); }
 
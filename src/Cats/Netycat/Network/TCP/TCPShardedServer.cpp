@@ -0,0 +1,105 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPShardedServer.hpp"
+
+#include <algorithm>
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+std::vector<std::unique_ptr<IOExecutor>> TCPShardedServer::createExecutors(std::size_t shardCount) {
+    
+    if(!shardCount) shardCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::unique_ptr<IOExecutor>> executors;
+    for(std::size_t i = 0; i < shardCount; ++i) executors.emplace_back(new IOExecutor);
+    return executors;
+    
+}
+
+TCPShardedServer::TCPShardedServer(std::size_t shardCount) : executors(createExecutors(shardCount)), server(*executors[0]) {}
+TCPShardedServer::~TCPShardedServer() {
+    
+    if(!threads.empty()) {
+        
+        stop();
+        join();
+        
+    }
+    
+}
+
+void TCPShardedServer::start(AcceptCallback cb_, std::size_t acceptCount) {
+    
+    if(running) throw Corecat::InvalidArgumentException("Server is already running");
+    if(!server.getHandle()) throw Corecat::InvalidArgumentException("Server is not listening");
+    cb = std::move(cb_);
+    running = true;
+    for(auto&& x : executors) x->beginWork();
+    for(auto&& x : executors) {
+        
+        auto executor = x.get();
+        server.acceptLoop(*executor, [this, executor](auto& e, auto& s) {
+            if(running) cb(e, *executor, s);
+        }, acceptCount);
+        
+    }
+    for(auto&& x : executors) {
+        
+        auto executor = x.get();
+        threads.emplace_back([executor]() { executor->run(); });
+        
+    }
+    
+}
+void TCPShardedServer::stop() {
+    
+    if(!running.exchange(false)) return;
+    executors[0]->execute([this]() { server.close(); });
+    for(auto&& x : executors) {
+        
+        auto executor = x.get();
+        executor->execute([executor]() { executor->endWork(); });
+        
+    }
+    
+}
+void TCPShardedServer::join() {
+    
+    for(auto&& x : threads) x.join();
+    threads.clear();
+    
+}
+
+}
+}
+}
+}
@@ -142,6 +142,27 @@ Corecat::Promise<std::size_t> TCPSocket::readAsync(void* buffer, std::size_t cou
     
 }
 
+std::size_t TCPSocket::read(IOBuffer& buffer, std::size_t count) {
+    
+    ExceptionPtr e;
+    auto ret = read(buffer, count, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t TCPSocket::read(IOBuffer& buffer, std::size_t count, ExceptionPtr& e) noexcept { return socket.read(buffer, count, e); }
+void TCPSocket::read(IOBuffer& buffer, std::size_t count, ReadCallback cb) noexcept { socket.read(buffer, count, std::move(cb)); }
+Corecat::Promise<std::size_t> TCPSocket::readAsync(IOBuffer& buffer, std::size_t count) noexcept {
+    
+    Promise<std::size_t> promise;
+    read(buffer, count, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+void TCPSocket::readPooled(ReadPooledCallback cb) noexcept { socket.readPooled(std::move(cb)); }
+
 std::size_t TCPSocket::readAll(void* buffer, std::size_t count) {
     
     ExceptionPtr e;
@@ -182,6 +203,26 @@ Corecat::Promise<std::size_t> TCPSocket::writeAsync(const void* buffer, std::siz
     
 }
 
+std::size_t TCPSocket::write(const IOBuffer& buffer) {
+    
+    ExceptionPtr e;
+    auto ret = write(buffer, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t TCPSocket::write(const IOBuffer& buffer, ExceptionPtr& e) noexcept { return socket.write(buffer, e); }
+void TCPSocket::write(const IOBuffer& buffer, WriteCallback cb) noexcept { socket.write(buffer, std::move(cb)); }
+Corecat::Promise<std::size_t> TCPSocket::writeAsync(const IOBuffer& buffer) noexcept {
+    
+    Promise<std::size_t> promise;
+    write(buffer, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
 std::size_t TCPSocket::writeAll(const void* buffer, std::size_t count) {
     
     ExceptionPtr e;
@@ -202,6 +243,39 @@ Corecat::Promise<std::size_t> TCPSocket::writeAllAsync(const void* buffer, std::
     
 }
 
+std::size_t TCPSocket::transmitFile(const File& file, std::uint64_t offset, std::size_t count) {
+    
+    ExceptionPtr e;
+    auto ret = transmitFile(file, offset, count, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t TCPSocket::transmitFile(const File& file, std::uint64_t offset, std::size_t count, ExceptionPtr& e) noexcept {
+    
+    return socket.transmitFile(file.getHandle(), offset, count, nullptr, 0, e);
+    
+}
+void TCPSocket::transmitFile(const File& file, std::uint64_t offset, std::size_t count, WriteCallback cb) noexcept {
+    
+    socket.transmitFile(file.getHandle(), offset, count, nullptr, 0, std::move(cb));
+    
+}
+void TCPSocket::transmitFile(const File& file, std::uint64_t offset, std::size_t count, const void* head, std::size_t headSize, WriteCallback cb) noexcept {
+    
+    socket.transmitFile(file.getHandle(), offset, count, head, headSize, std::move(cb));
+    
+}
+Corecat::Promise<std::size_t> TCPSocket::transmitFileAsync(const File& file, std::uint64_t offset, std::size_t count) noexcept {
+    
+    Promise<std::size_t> promise;
+    transmitFile(file, offset, count, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
+}
+
 TCPSocket::EndpointType TCPSocket::getRemoteEndpoint() {
     
     ExceptionPtr e;
@@ -224,6 +298,50 @@ TCPSocket::EndpointType TCPSocket::getRemoteEndpoint(ExceptionPtr& e) noexcept {
     
 }
 
+bool TCPSocket::isReadable() {
+    
+    ExceptionPtr e;
+    auto ret = isReadable(e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+bool TCPSocket::isReadable(ExceptionPtr& e) noexcept {
+    
+    return socket.isReadable(e);
+    
+}
+
+void TCPSocket::setOption(const TCPOption& option) {
+    
+    ExceptionPtr e;
+    setOption(option, e);
+    if(e) e.rethrow();
+    
+}
+void TCPSocket::setOption(const TCPOption& option, ExceptionPtr& e) noexcept {
+    
+    int value = option.getValue();
+    socket.setOption(option.getLevel(), option.getName(), &value, sizeof(value), e);
+    
+}
+int TCPSocket::getOption(const TCPOption& option) {
+    
+    ExceptionPtr e;
+    auto ret = getOption(option, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+int TCPSocket::getOption(const TCPOption& option, ExceptionPtr& e) noexcept {
+    
+    int value = 0;
+    socklen_t size = sizeof(value);
+    socket.getOption(option.getLevel(), option.getName(), &value, size, e);
+    return value;
+    
+}
+
 TCPSocket::NativeHandleType TCPSocket::getHandle() noexcept { return socket.getHandle(); }
 void TCPSocket::setHandle(NativeHandleType handle) noexcept { socket.setHandle(handle); }
 
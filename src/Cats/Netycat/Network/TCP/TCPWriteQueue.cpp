@@ -0,0 +1,140 @@
+/*
+ *
+ * MIT License
+ *
+ * Copyright (c) 2016-2018 The Cats Project
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "Cats/Netycat/Network/TCP/TCPWriteQueue.hpp"
+
+#include "Cats/Corecat/Util/Exception.hpp"
+
+
+namespace Cats {
+namespace Netycat {
+inline namespace Network {
+inline namespace TCP {
+
+TCPWriteQueue::TCPWriteQueue(TCPSocket& socket_, std::size_t highWatermark_, std::size_t lowWatermark_) :
+    socket(socket_), highWatermark(highWatermark_), lowWatermark(lowWatermark_ < highWatermark_ ? lowWatermark_ : highWatermark_),
+    alive(std::make_shared<bool>(true)) {}
+TCPWriteQueue::~TCPWriteQueue() { *alive = false; }
+
+bool TCPWriteQueue::enqueue(std::size_t count) {
+    
+    size += count;
+    if(writable && size >= highWatermark) {
+        
+        writable = false;
+        if(writabilityCallback) writabilityCallback(false);
+        
+    }
+    if(!writing) send();
+    return writable;
+    
+}
+void TCPWriteQueue::send() {
+    
+    if(sending.isEmpty()) sending = std::move(pending);
+    else sending.append(std::move(pending));
+    if(sending.isEmpty()) return;
+    writing = true;
+    auto self = this;
+    auto alive = this->alive;
+    socket.write(sending, [=](auto& e, auto count) { if(*alive) self->complete(e, count); });
+    
+}
+void TCPWriteQueue::complete(const ExceptionPtr& e, std::size_t count) {
+    
+    writing = false;
+    if(e) { fail(e); return; }
+    if(!count) { fail(Corecat::IOException("Connection closed")); return; }
+    sending.trimFront(count);
+    size -= count;
+    if(!writable && size <= lowWatermark) {
+        
+        writable = true;
+        if(writabilityCallback) writabilityCallback(true);
+        
+    }
+    if(!size && !flushList.empty()) {
+        
+        auto list = std::move(flushList);
+        flushList.clear();
+        for(auto& cb : list) cb(ExceptionPtr());
+        
+    }
+    if(!writing && !exception) send();
+    
+}
+void TCPWriteQueue::fail(const ExceptionPtr& e) {
+    
+    exception = e;
+    pending.clear();
+    sending.clear();
+    size = 0;
+    if(errorCallback) errorCallback(e);
+    auto list = std::move(flushList);
+    flushList.clear();
+    for(auto& cb : list) cb(e);
+    
+}
+
+bool TCPWriteQueue::write(const void* buffer, std::size_t count) {
+    
+    if(exception) return false;
+    if(!count) return writable;
+    pending.append(buffer, count);
+    return enqueue(count);
+    
+}
+bool TCPWriteQueue::write(IOBuffer&& buffer) {
+    
+    if(exception) return false;
+    auto count = buffer.getSize();
+    if(!count) return writable;
+    pending.append(std::move(buffer));
+    return enqueue(count);
+    
+}
+
+void TCPWriteQueue::flush(FlushCallback cb) {
+    
+    if(exception) cb(exception);
+    else if(!size) cb(ExceptionPtr());
+    else flushList.push_back(std::move(cb));
+    
+}
+Corecat::Promise<> TCPWriteQueue::flushAsync() {
+    
+    Promise<> promise;
+    flush([=](auto& e) {
+        e ? promise.reject(e) : promise.resolve();
+    });
+    return promise;
+    
+}
+
+}
+}
+}
+}
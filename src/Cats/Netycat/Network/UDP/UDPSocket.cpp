@@ -203,6 +203,61 @@ Corecat::Promise<std::size_t> UDPSocket::readFromAsync(void* buffer, std::size_t
     
     return readFromAsync(buffer, count, endpoint.getAddress(), endpoint.getPort());
     
+}
+std::size_t UDPSocket::readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint) {
+    
+    ExceptionPtr e;
+    auto ret = readFrom(buffer, count, endpoint, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t UDPSocket::readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint, ExceptionPtr& e) noexcept {
+    
+    sockaddr_storage saddr;
+    socklen_t saddrSize = sizeof(saddr);
+    std::size_t ret = socket.readFrom(buffer, count, &saddr, saddrSize, e);
+    if(e) return 0;
+    Impl::fromSockaddr(&saddr, saddrSize, endpoint.getAddress(), endpoint.getPort(), e);
+    if(e) return 0;
+    return ret;
+    
+}
+void UDPSocket::readFrom(IOBuffer& buffer, std::size_t count, EndpointType& endpoint, ReadCallback cb) noexcept {
+    
+    struct AddressBuffer {
+        
+        sockaddr_storage saddr;
+        socklen_t saddrSize = sizeof(saddr);
+        
+    };
+    auto addressBuffer = new AddressBuffer;
+    socket.readFrom(buffer, count, &addressBuffer->saddr, addressBuffer->saddrSize, [=, &endpoint, cb = std::move(cb)](auto& e, auto count) {
+        
+        if(e) {
+            
+            delete addressBuffer;
+            cb(e, count);
+            return;
+            
+        }
+        ExceptionPtr e1;
+        Impl::fromSockaddr(&addressBuffer->saddr, addressBuffer->saddrSize, endpoint.getAddress(), endpoint.getPort(), e1);
+        delete addressBuffer;
+        if(e1) { cb(e1, 0); return; }
+        cb({}, count);
+        
+    });
+    
+}
+Corecat::Promise<std::size_t> UDPSocket::readFromAsync(IOBuffer& buffer, std::size_t count, EndpointType& endpoint) noexcept {
+    
+    Promise<std::size_t> promise;
+    readFrom(buffer, count, endpoint, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
 }
 
 std::size_t UDPSocket::writeTo(const void* buffer, std::size_t count, const IPAddress& address, std::uint16_t port) {
@@ -263,6 +318,42 @@ Corecat::Promise<std::size_t> UDPSocket::writeToAsync(const void* buffer, std::s
     
     return writeToAsync(buffer, count, endpoint.getAddress(), endpoint.getPort());
     
+}
+std::size_t UDPSocket::writeTo(const IOBuffer& buffer, const EndpointType& endpoint) {
+    
+    ExceptionPtr e;
+    auto ret = writeTo(buffer, endpoint, e);
+    if(e) e.rethrow();
+    return ret;
+    
+}
+std::size_t UDPSocket::writeTo(const IOBuffer& buffer, const EndpointType& endpoint, ExceptionPtr& e) noexcept {
+    
+    sockaddr_storage saddr;
+    socklen_t saddrSize = sizeof(sockaddr_storage);
+    Impl::toSockaddr(&saddr, saddrSize, endpoint.getAddress(), endpoint.getPort(), e);
+    if(e) return 0;
+    return socket.writeTo(buffer, &saddr, saddrSize, e);
+    
+}
+void UDPSocket::writeTo(const IOBuffer& buffer, const EndpointType& endpoint, WriteCallback cb) noexcept {
+    
+    ExceptionPtr e;
+    sockaddr_storage saddr;
+    socklen_t saddrSize = sizeof(sockaddr_storage);
+    Impl::toSockaddr(&saddr, saddrSize, endpoint.getAddress(), endpoint.getPort(), e);
+    if(e) { cb(e, 0); return; }
+    socket.writeTo(buffer, &saddr, saddrSize, std::move(cb));
+    
+}
+Corecat::Promise<std::size_t> UDPSocket::writeToAsync(const IOBuffer& buffer, const EndpointType& endpoint) noexcept {
+    
+    Promise<std::size_t> promise;
+    writeTo(buffer, endpoint, [=](auto& e, auto count) {
+        e ? promise.reject(e) : promise.resolve(count);
+    });
+    return promise;
+    
 }
 
 UDPSocket::NativeHandleType UDPSocket::getHandle() noexcept { return socket.getHandle(); }
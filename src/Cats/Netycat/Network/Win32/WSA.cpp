@@ -41,6 +41,7 @@ void WSA::getExtensionFunction(SOCKET socket, GUID guid, void** p) {
 }
 LPFN_ACCEPTEX WSA::AcceptEx = nullptr;
 LPFN_CONNECTEX WSA::ConnectEx = nullptr;
+LPFN_TRANSMITFILE WSA::TransmitFile = nullptr;
 
 WSA::WSA() {
     
@@ -51,6 +52,7 @@ WSA::WSA() {
         
         getExtensionFunction(socket, WSAID_ACCEPTEX, reinterpret_cast<void**>(&AcceptEx));
         getExtensionFunction(socket, WSAID_CONNECTEX, reinterpret_cast<void**>(&ConnectEx));
+        getExtensionFunction(socket, WSAID_TRANSMITFILE, reinterpret_cast<void**>(&TransmitFile));
         ::closesocket(socket);
         
     }